@@ -0,0 +1,148 @@
+#include "AppEntry.h"
+
+//--------------------------------------------------------------
+bool AppEntry::sameLaunchAs(const AppEntry& other) const {
+    return path == other.path && args == other.args && env == other.env && workingDir == other.workingDir;
+}
+
+//--------------------------------------------------------------
+string appNameFromPath(const string& appPath) {
+    string appName = appPath;
+
+    // Remove .app extension if present
+    size_t appPos = appName.rfind(".app");
+    if (appPos != string::npos) {
+        appName = appName.substr(0, appPos);
+    }
+
+    // Get just the app name (last component of path)
+    size_t lastSlash = appName.rfind('/');
+    if (lastSlash != string::npos) {
+        appName = appName.substr(lastSlash + 1);
+    }
+    return appName;
+}
+
+//--------------------------------------------------------------
+vector<string> splitArguments(const string& line) {
+    vector<string> result;
+    string current;
+    bool inQuotes = false;
+    bool hasToken = false;
+
+    for (size_t i = 0; i < line.length(); i++) {
+        char c = line[i];
+        if (c == '\\' && i + 1 < line.length()) {
+            current += line[++i];
+            hasToken = true;
+        } else if (c == '"') {
+            inQuotes = !inQuotes;
+            hasToken = true;  // "" is an empty argument
+        } else if ((c == ' ' || c == '\t') && !inQuotes) {
+            if (hasToken) {
+                result.push_back(current);
+                current.clear();
+                hasToken = false;
+            }
+        } else {
+            current += c;
+            hasToken = true;
+        }
+    }
+    if (hasToken) {
+        result.push_back(current);
+    }
+    return result;
+}
+
+//--------------------------------------------------------------
+// "key: value" option line? Keys are plain words; app lines start with a
+// delay or a path, so they never look like this.
+static bool parseOption(const string& line, string& key, string& value) {
+    size_t colon = line.find(':');
+    if (colon == string::npos || colon == 0) return false;
+    for (size_t i = 0; i < colon; i++) {
+        if (!isalpha((unsigned char)line[i])) return false;
+    }
+    key = line.substr(0, colon);
+    value = line.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(" \t"));
+    return true;
+}
+
+//--------------------------------------------------------------
+bool loadAppEntries(const string& path, vector<AppEntry>& apps) {
+    apps.clear();
+
+    ofFile file(path);
+    if (!file.exists()) {
+        return false;
+    }
+
+    ofBuffer buffer = file.readToBuffer();
+    int lineNumber = 0;
+    for (auto& line : buffer.getLines()) {
+        lineNumber++;
+        string trimmed = line;
+        // Trim whitespace
+        trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r"));
+        trimmed.erase(trimmed.find_last_not_of(" \t\n\r") + 1);
+
+        if (trimmed.length() == 0 || trimmed[0] == '#') continue;
+
+        string key, value;
+        if (parseOption(trimmed, key, value)) {
+            if (apps.empty()) {
+                ofLogWarning("AppEntry") << path << ":" << lineNumber << ": option '" << key << "' before any app, ignored";
+                continue;
+            }
+            AppEntry& app = apps.back();
+            if (key == "args") {
+                app.args = splitArguments(value);
+            } else if (key == "env") {
+                for (auto& assignment : splitArguments(value)) {
+                    if (assignment.find('=') == string::npos) {
+                        ofLogWarning("AppEntry") << path << ":" << lineNumber << ": env entry '" << assignment << "' needs KEY=VALUE";
+                        continue;
+                    }
+                    app.env.push_back(assignment);
+                }
+            } else if (key == "cwd") {
+                app.workingDir = value;
+            } else if (key == "after") {
+                for (auto& name : splitArguments(value)) {
+                    app.after.push_back(name);
+                }
+            } else if (key == "ready") {
+                string error;
+                if (!app.ready.parse(value, error)) {
+                    ofLogWarning("AppEntry") << path << ":" << lineNumber << ": ready: " << error;
+                    app.ready = ReadinessProbe();
+                }
+            } else if (key == "timeout") {
+                app.readyTimeout = max(0.0f, ofToFloat(value));
+            } else {
+                ofLogWarning("AppEntry") << path << ":" << lineNumber << ": unknown option '" << key << "'";
+            }
+            continue;
+        }
+
+        // Parse format: "delay, /path/to/app" or just "/path/to/app"
+        AppEntry app;
+        app.path = trimmed;
+
+        size_t commaPos = trimmed.find(',');
+        if (commaPos != string::npos) {
+            // Has delay prefix
+            string delayStr = trimmed.substr(0, commaPos);
+            app.delay = ofToInt(delayStr);
+            app.path = trimmed.substr(commaPos + 1);
+            // Trim whitespace from path
+            app.path.erase(0, app.path.find_first_not_of(" \t"));
+            app.path.erase(app.path.find_last_not_of(" \t\n\r") + 1);
+        }
+        app.name = appNameFromPath(app.path);
+        apps.push_back(app);
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ReadinessProbe.h"
+
+// One app from appsToControl.txt:
+//
+//   12, /Applications/artnetTester.app
+//       args: --port 6454 "--title=Artnet Tester"
+//       env: OSC_PORT=9000 LOG_LEVEL=debug
+//       cwd: /Users/show/artnet
+//       after: muonDetector
+//       ready: port 6454
+//       timeout: 30
+//
+// The first line is "delay, path" (delay optional). Indented "key: value"
+// lines after it add options to that app; env may appear more than once.
+// See LaunchPipeline for how delay, after and ready work together.
+struct AppEntry {
+    string path;
+    int delay = 0;              // seconds to wait before launching
+    vector<string> args;        // extra command line arguments
+    vector<string> env;         // KEY=VALUE, added to (or replacing) our environment
+    string workingDir;          // empty = inherit
+
+    vector<string> after;       // names (or paths) of apps that must be ready first
+    ReadinessProbe ready;       // how to tell this app is ready
+    float readyTimeout = 60;    // give up waiting for 'ready' after this many seconds
+
+    string name;                // process name, derived from path
+
+    bool sameLaunchAs(const AppEntry& other) const;
+};
+
+// "App" / "tool" from "/path/to/App.app" / "/usr/bin/tool"
+string appNameFromPath(const string& appPath);
+
+// Split a command line on whitespace, honouring "double quotes" and \-escapes
+vector<string> splitArguments(const string& line);
+
+// Parse appsToControl.txt. Returns false if the file doesn't exist.
+bool loadAppEntries(const string& path, vector<AppEntry>& apps);
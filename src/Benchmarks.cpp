@@ -0,0 +1,62 @@
+#include "Benchmarks.h"
+#include "ProcessTable.h"
+
+using Clock = chrono::steady_clock;
+
+//--------------------------------------------------------------
+static double millisSince(Clock::time_point start) {
+    return chrono::duration<double, milli>(Clock::now() - start).count();
+}
+
+//--------------------------------------------------------------
+int Benchmarks::run(const string& name) {
+    if (name == "proctable") {
+        processTable();
+    } else if (name == "all") {
+        processTable();
+    } else {
+        ofLogError("Benchmarks") << "Unknown benchmark '" << name << "' (try: proctable, all)";
+        return 1;
+    }
+    return 0;
+}
+
+//--------------------------------------------------------------
+void Benchmarks::processTable() {
+    ofLog() << "ProcessTable vs pgrep (per tick, all apps checked once)";
+
+    ProcessTable table;
+    for (int numApps : {10, 100, 1000}) {
+        // Mostly names that aren't running, plus a few that always are
+        vector<string> names;
+        for (int i = 0; i < numApps; i++) {
+            names.push_back((i % 10 == 0) ? "launchd" : "benchApp" + ofToString(i));
+        }
+
+        // Old path: fork a shell and pgrep for every app
+        auto start = Clock::now();
+        int pgrepRunning = 0;
+        for (auto& name : names) {
+            string command = "pgrep -x \"" + name + "\" > /dev/null 2>&1";
+            if (system(command.c_str()) == 0) pgrepRunning++;
+        }
+        double pgrepMs = millisSince(start);
+
+        // New path: one scan, then hash lookups
+        const int rounds = 20;
+        int tableRunning = 0;
+        start = Clock::now();
+        for (int r = 0; r < rounds; r++) {
+            tableRunning = 0;
+            table.refresh();
+            for (auto& name : names) {
+                if (table.isRunning(name)) tableRunning++;
+            }
+        }
+        double tableMs = millisSince(start) / rounds;
+
+        ofLog() << "  " << numApps << " apps: pgrep " << pgrepMs << " ms, table " << tableMs
+                << " ms (" << table.size() << " processes scanned), speedup x" << (pgrepMs / max(tableMs, 0.001))
+                << (pgrepRunning == tableRunning ? "" : "  [results differ]");
+    }
+}
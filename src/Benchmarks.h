@@ -0,0 +1,12 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Micro-benchmarks, run with: onOFFonAGAIN --benchmark <name>
+// They print their results to the log and don't touch the data folder.
+namespace Benchmarks {
+    int run(const string& name);
+
+    // ProcessTable (one scan + hash lookups) vs. one "pgrep -x" per app
+    void processTable();
+}
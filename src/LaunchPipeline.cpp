@@ -0,0 +1,258 @@
+#include "LaunchPipeline.h"
+
+// How often a readiness probe is retried
+static const float PROBE_INTERVAL = 0.25;
+
+// A launch that was submitted but never reported back counts as failed after this
+static const float START_TIMEOUT = 30;
+
+//--------------------------------------------------------------
+void LaunchPipeline::start(const vector<AppEntry>& apps, float now) {
+    steps.clear();
+    steps.resize(apps.size());
+    for (size_t i = 0; i < apps.size(); i++) {
+        Step& step = steps[i];
+        step.name = apps[i].name;
+        step.delay = (float)apps[i].delay;
+        step.readyTimeout = apps[i].readyTimeout;
+        step.probe = apps[i].ready;
+    }
+    resolveDependencies(apps);
+
+    startTime = now;
+    active = !steps.empty();
+    generation++;
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::cancel() {
+    active = false;
+    generation++;
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::resolveDependencies(const vector<AppEntry>& apps) {
+    bool explicitDeps = false;
+    for (auto& app : apps) {
+        if (!app.after.empty()) explicitDeps = true;
+    }
+
+    if (!explicitDeps) {
+        // Old style: one after the other, in file order
+        for (size_t i = 1; i < steps.size(); i++) {
+            steps[i].deps.push_back((int)i - 1);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < apps.size(); i++) {
+        for (auto& name : apps[i].after) {
+            int found = -1;
+            for (size_t j = 0; j < apps.size(); j++) {
+                if (j != i && (apps[j].name == name || apps[j].path == name)) {
+                    found = (int)j;
+                    break;
+                }
+            }
+            if (found < 0) {
+                ofLogWarning("LaunchPipeline") << apps[i].name << ": unknown app '" << name << "' in after:, ignored";
+            } else {
+                steps[i].deps.push_back(found);
+            }
+        }
+    }
+
+    // Anything left over after peeling off apps whose prerequisites can all
+    // be satisfied is part of a cycle; those start without waiting
+    vector<int> pending(steps.size());
+    vector<int> order;
+    for (size_t i = 0; i < steps.size(); i++) {
+        pending[i] = (int)steps[i].deps.size();
+        if (pending[i] == 0) order.push_back((int)i);
+    }
+    for (size_t k = 0; k < order.size(); k++) {
+        for (size_t i = 0; i < steps.size(); i++) {
+            for (int dep : steps[i].deps) {
+                if (dep == order[k] && --pending[i] == 0) {
+                    order.push_back((int)i);
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < steps.size(); i++) {
+        if (pending[i] > 0) {
+            ofLogError("LaunchPipeline") << steps[i].name << " is part of a dependency cycle, starting it without waiting";
+            steps[i].deps.clear();
+        }
+    }
+}
+
+//--------------------------------------------------------------
+bool LaunchPipeline::prerequisitesSettled(int appIndex, float& settledAt) const {
+    settledAt = startTime;
+    for (int dep : steps[appIndex].deps) {
+        const Step& prerequisite = steps[dep];
+        if (prerequisite.stage != Ready && prerequisite.stage != Failed) {
+            return false;
+        }
+        settledAt = max(settledAt, startTime + prerequisite.readySeconds);
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::update(float now, vector<int>& due) {
+    due.clear();
+    if (!active) return;
+
+    // Timeouts first, so apps waiting on them are released in the same call
+    for (int i = 0; i < (int)steps.size(); i++) {
+        Step& step = steps[i];
+        if (step.stage == Probing && now - step.stageStart >= step.readyTimeout) {
+            ofLogWarning("LaunchPipeline") << step.name << " not ready after " << step.readyTimeout
+                                           << "s (" << step.probe.describe() << "), going ahead anyway";
+            step.timedOut = true;
+            settle(i, Ready, now);
+        } else if (step.stage == Starting && now - step.stageStart >= START_TIMEOUT) {
+            ofLogWarning("LaunchPipeline") << step.name << " was never reported as launched, giving up on it";
+            settle(i, Failed, now);
+        }
+    }
+
+    bool allSettled = true;
+    for (int i = 0; i < (int)steps.size(); i++) {
+        Step& step = steps[i];
+
+        if (step.stage == Waiting) {
+            float settledAt;
+            if (prerequisitesSettled(i, settledAt)) {
+                // The delay counts from when the last prerequisite became ready
+                step.stage = Delaying;
+                step.stageStart = settledAt;
+            }
+        }
+
+        if (step.stage == Delaying && now - step.stageStart >= step.delay) {
+            due.push_back(i);
+        }
+
+        if (step.stage != Ready && step.stage != Failed) {
+            allSettled = false;
+        }
+    }
+
+    if (allSettled) {
+        active = false;
+        float total = 0;
+        for (auto& step : steps) total = max(total, step.readySeconds);
+        ofLog() << "All apps ready after " << total << "s";
+    }
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::takeProbes(float now, vector<PendingProbe>& probes) const {
+    probes.clear();
+    if (!active) return;
+    for (int i = 0; i < (int)steps.size(); i++) {
+        const Step& step = steps[i];
+        if (step.stage == Probing && now >= step.nextProbe) {
+            probes.push_back({i, generation, step.check});
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::putProbes(const vector<PendingProbe>& probes, float now) {
+    for (auto& probe : probes) {
+        if (!active || probe.generation != generation) return;
+        Step& step = steps[probe.appIndex];
+        if (step.stage != Probing) continue;
+
+        step.check = probe.check;  // keeps how far a log file was read
+        if (probe.ready) {
+            settle(probe.appIndex, Ready, now);
+        } else {
+            step.nextProbe = now + PROBE_INTERVAL;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::launching(int appIndex, float now) {
+    Step& step = steps[appIndex];
+    step.stage = Starting;
+    step.stageStart = now;
+    // Before the app runs, so log lines it writes right away are seen
+    step.check.start(step.probe);
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::alreadyRunning(int appIndex, float now) {
+    // It was up before this sequence started
+    settle(appIndex, Ready, now);
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::launched(int appIndex, float now) {
+    if (!active || appIndex >= (int)steps.size()) return;
+    Step& step = steps[appIndex];
+    if (step.stage != Starting) return;
+
+    if (step.probe.type == ReadinessProbe::None) {
+        settle(appIndex, Ready, now);
+    } else {
+        step.stage = Probing;
+        step.stageStart = now;
+        step.nextProbe = now;
+    }
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::launchFailed(int appIndex, float now) {
+    if (!active || appIndex >= (int)steps.size()) return;
+    if (steps[appIndex].stage != Starting) return;
+    settle(appIndex, Failed, now);
+}
+
+//--------------------------------------------------------------
+void LaunchPipeline::settle(int appIndex, Stage stage, float now) {
+    Step& step = steps[appIndex];
+    step.stage = stage;
+    step.stageStart = now;
+    step.readySeconds = now - startTime;
+    if (stage == Ready) {
+        ofLog() << "  " << step.name << " ready after " << step.readySeconds << "s";
+    }
+}
+
+//--------------------------------------------------------------
+bool LaunchPipeline::hasStarted(int appIndex) const {
+    if (appIndex >= (int)steps.size()) return false;
+    Stage stage = steps[appIndex].stage;
+    return stage == Starting || stage == Probing || stage == Ready;
+}
+
+//--------------------------------------------------------------
+float LaunchPipeline::secondsUntilNextCheck(float now) const {
+    if (!active) return -1;
+
+    float next = -1;
+    auto consider = [&next](float seconds) {
+        seconds = max(0.0f, seconds);
+        if (next < 0 || seconds < next) next = seconds;
+    };
+    for (int i = 0; i < (int)steps.size(); i++) {
+        const Step& step = steps[i];
+        float settledAt;
+        if (step.stage == Waiting && prerequisitesSettled(i, settledAt)) {
+            consider(0);  // update() moves it on right away
+        } else if (step.stage == Delaying) {
+            consider(step.stageStart + step.delay - now);
+        } else if (step.stage == Starting) {
+            consider(step.stageStart + START_TIMEOUT - now);
+        } else if (step.stage == Probing) {
+            consider(min(step.nextProbe, step.stageStart + step.readyTimeout) - now);
+        }
+    }
+    return next;
+}
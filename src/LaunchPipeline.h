@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ofMain.h"
+#include "AppEntry.h"
+#include "ReadinessProbe.h"
+
+// Decides when each app of a launch sequence may start. An app waits until
+// every app it depends on ("after:") is ready, then for its own delay, then
+// gets launched and probed ("ready:") until it is ready itself. Independent
+// apps go in parallel, so the whole set is up after the critical path
+// instead of the sum of all delays.
+//
+// If no app has an "after:" line, each app depends on the one above it,
+// which is the old one-by-one behaviour.
+//
+// Not thread-safe; the scheduler drives it with its lock held.
+class LaunchPipeline {
+public:
+    enum Stage {
+        Waiting,    // for prerequisites
+        Delaying,   // prerequisites ready, counting down the delay
+        Starting,   // launch submitted, waiting for the spawn
+        Probing,    // running, waiting for the readiness probe
+        Ready,
+        Failed      // couldn't be launched; dependents go ahead anyway
+    };
+
+    struct Step {
+        Stage stage = Waiting;
+        vector<int> deps;
+        float stageStart = 0;       // when the current stage began (ofGetElapsedTimef)
+        float readySeconds = -1;    // time from the start of the sequence to ready/failed
+        bool timedOut = false;      // probe never succeeded, went ahead after readyTimeout
+        float nextProbe = 0;        // when to check the probe again
+
+        // Copied from the AppEntry, so the app list may be reloaded meanwhile
+        string name;
+        float delay = 0;
+        float readyTimeout = 0;
+        ReadinessProbe probe;
+        ReadinessCheck check;
+    };
+
+    void start(const vector<AppEntry>& apps, float now);
+    void cancel();
+    bool isActive() const { return active; }
+
+    // Moves steps along and fills 'due' with the apps to launch now. For each
+    // one the caller calls launching() or alreadyRunning(). Call again until
+    // 'due' comes back empty, so apps freed up by those calls start as well.
+    void update(float now, vector<int>& due);
+
+    // Probes do file and socket I/O, so the scheduler runs them without its
+    // lock: takeProbes() copies out the ones that are due, the caller checks
+    // them and hands them back with putProbes(). Results for a sequence that
+    // was restarted or cancelled in between are dropped.
+    struct PendingProbe {
+        int appIndex;
+        unsigned generation;
+        ReadinessCheck check;
+        bool ready = false;
+    };
+    void takeProbes(float now, vector<PendingProbe>& probes) const;
+    void putProbes(const vector<PendingProbe>& probes, float now);
+
+    void launching(int appIndex, float now);
+    void alreadyRunning(int appIndex, float now);
+    void launched(int appIndex, float now);        // spawn succeeded
+    void launchFailed(int appIndex, float now);
+
+    // Launched (or on its way) in this sequence
+    bool hasStarted(int appIndex) const;
+
+    // Seconds until something needs checking again, -1 if only events can move things on
+    float secondsUntilNextCheck(float now) const;
+
+    size_t size() const { return steps.size(); }
+    const Step& getStep(int appIndex) const { return steps[appIndex]; }
+    float getStartTime() const { return startTime; }
+
+private:
+    void resolveDependencies(const vector<AppEntry>& apps);
+    bool prerequisitesSettled(int appIndex, float& settledAt) const;
+    void settle(int appIndex, Stage stage, float now);
+
+    vector<Step> steps;
+    bool active = false;
+    unsigned generation = 0;    // bumped by start() and cancel()
+    float startTime = 0;
+};
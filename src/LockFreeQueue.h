@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded single-producer/single-consumer ring buffer.
+// Exactly one thread may push() and exactly one thread may pop(); neither
+// ever blocks or takes a lock. push() fails instead of growing when full.
+template<typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity = 256)
+    : buffer(roundUpToPowerOfTwo(capacity)), mask(buffer.size() - 1) {
+    }
+
+    bool push(const T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == buffer.size()) {
+            return false;  // full
+        }
+        buffer[h & mask] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;  // empty
+        }
+        item = std::move(buffer[t & mask]);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t roundUpToPowerOfTwo(size_t n) {
+        size_t size = 1;
+        while (size < n) size <<= 1;
+        return size;
+    }
+
+    std::vector<T> buffer;
+    const size_t mask;
+    alignas(64) std::atomic<size_t> head{0};  // written by the producer
+    alignas(64) std::atomic<size_t> tail{0};  // written by the consumer
+};
@@ -0,0 +1,149 @@
+#include "ProcessLauncher.h"
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+
+extern char** environ;
+
+//--------------------------------------------------------------
+// Value of <key>CFBundleExecutable</key><string>...</string> in Info.plist
+static string readBundleExecutable(const string& bundlePath) {
+    ofFile plist(bundlePath + "/Contents/Info.plist");
+    if (!plist.exists()) return "";
+
+    string text = plist.readToBuffer().getText();
+    size_t key = text.find("<key>CFBundleExecutable</key>");
+    if (key == string::npos) return "";
+    size_t start = text.find("<string>", key);
+    size_t end = text.find("</string>", start);
+    if (start == string::npos || end == string::npos) return "";
+    start += 8;
+    return text.substr(start, end - start);
+}
+
+//--------------------------------------------------------------
+string ProcessLauncher::resolveExecutable(const string& appPath) {
+    string path = appPath;
+    while (path.length() > 1 && path.back() == '/') {
+        path.pop_back();
+    }
+    if (path.length() < 4 || path.compare(path.length() - 4, 4, ".app") != 0) {
+        return path;  // plain executable
+    }
+
+    string executable = readBundleExecutable(path);
+    if (executable.empty()) {
+        executable = appNameFromPath(path);  // the usual default
+    }
+    return path + "/Contents/MacOS/" + executable;
+}
+
+//--------------------------------------------------------------
+ProcessLauncher::Result ProcessLauncher::spawn(const AppEntry& app) {
+    string executable = resolveExecutable(app.path);
+
+    vector<string> argv;
+    argv.push_back(executable);
+    argv.insert(argv.end(), app.args.begin(), app.args.end());
+
+    return spawnArgv(executable, argv, app.env, app.workingDir);
+}
+
+//--------------------------------------------------------------
+ProcessLauncher::Result ProcessLauncher::spawnHelper(const vector<string>& argv) {
+    return spawnArgv(argv[0], argv, {}, "");
+}
+
+//--------------------------------------------------------------
+ProcessLauncher::Result ProcessLauncher::spawnArgv(const string& executable, const vector<string>& argv,
+                                                   const vector<string>& env, const string& workingDir) {
+    Result result;
+
+    vector<char*> argvPtrs;
+    for (auto& arg : argv) {
+        argvPtrs.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argvPtrs.push_back(nullptr);
+
+    // Our environment, minus any variable the app overrides, plus the app's own
+    vector<char*> envPtrs;
+    for (char** e = environ; *e; e++) {
+        const char* eq = strchr(*e, '=');
+        size_t keyLength = eq ? eq - *e + 1 : strlen(*e);
+        bool overridden = false;
+        for (auto& assignment : env) {
+            if (assignment.compare(0, keyLength, *e, keyLength) == 0) {
+                overridden = true;
+                break;
+            }
+        }
+        if (!overridden) envPtrs.push_back(*e);
+    }
+    for (auto& assignment : env) {
+        envPtrs.push_back(const_cast<char*>(assignment.c_str()));
+    }
+    envPtrs.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (!workingDir.empty()) {
+        posix_spawn_file_actions_addchdir_np(&actions, workingDir.c_str());
+    }
+
+    // Own process group (a Ctrl-C in our terminal doesn't hit the apps) and a
+    // clean signal mask (headless mode blocks SIGINT/SIGTERM in our threads)
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    sigset_t emptyMask;
+    sigemptyset(&emptyMask);
+    posix_spawnattr_setsigmask(&attr, &emptyMask);
+    posix_spawnattr_setpgroup(&attr, 0);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETPGROUP);
+
+    auto start = chrono::steady_clock::now();
+    int err = posix_spawn(&result.pid, executable.c_str(), &actions, &attr, argvPtrs.data(), envPtrs.data());
+    result.spawnMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (err != 0) {
+        result.pid = -1;
+        result.error = executable + ": " + strerror(err);
+    }
+    return result;
+}
+
+#ifdef __APPLE__
+//--------------------------------------------------------------
+// Quote a string for an AppleScript string literal
+static string appleScriptString(const string& s) {
+    string quoted = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+#endif
+
+//--------------------------------------------------------------
+pid_t ProcessLauncher::requestQuit(const AppEntry& app, pid_t pid, string& error) {
+#ifdef __APPLE__
+    // Bundles get a proper "quit" AppleEvent so they can shut down cleanly
+    bool isBundle = app.path.find(".app") != string::npos;
+    if (isBundle) {
+        Result helper = spawnHelper({"/usr/bin/osascript", "-e", "tell application " + appleScriptString(app.name) + " to quit"});
+        error = helper.error;
+        return helper.pid;
+    }
+#endif
+    if (pid <= 0) {
+        return 0;  // not running, nothing to quit
+    }
+    if (kill(pid, SIGTERM) != 0) {
+        error = app.name + ": " + strerror(errno);
+        return -1;
+    }
+    return 0;
+}
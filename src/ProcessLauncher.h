@@ -0,0 +1,34 @@
+#pragma once
+
+#include "ofMain.h"
+#include "AppEntry.h"
+#include <sys/types.h>
+
+// Starts apps directly with posix_spawn() - no /bin/sh in between, so paths
+// and arguments are passed through untouched and we get the app's own PID.
+// A macOS .app bundle is started through its Contents/MacOS executable.
+class ProcessLauncher {
+public:
+    struct Result {
+        pid_t pid = -1;
+        string error;           // empty on success
+        double spawnMillis = 0; // time spent in posix_spawn()
+    };
+
+    static Result spawn(const AppEntry& app);
+
+    // Spawn a helper with a fixed argv (e.g. osascript), no shell involved
+    static Result spawnHelper(const vector<string>& argv);
+
+    // The binary to exec for an app path (resolves .app bundles)
+    static string resolveExecutable(const string& appPath);
+
+    // Ask an app to quit: AppleEvent for macOS bundles, SIGTERM otherwise.
+    // Returns the PID of the helper it started, 0 if a signal was enough
+    // (or the app isn't running), -1 on error.
+    static pid_t requestQuit(const AppEntry& app, pid_t pid, string& error);
+
+private:
+    static Result spawnArgv(const string& executable, const vector<string>& argv,
+                            const vector<string>& env, const string& workingDir);
+};
@@ -0,0 +1,112 @@
+#include "ProcessTable.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <libproc.h>
+#endif
+
+//--------------------------------------------------------------
+void ProcfsBackend::enumerate(vector<ProcessInfo>& out) {
+    out.clear();
+
+    DIR* dir = opendir("/proc");
+    if (!dir) {
+        ofLogError("ProcessTable") << "Can't open /proc";
+        return;
+    }
+
+    char path[64];
+    char name[64];
+    while (dirent* entry = readdir(dir)) {
+        // Only numeric entries are processes
+        const char* d = entry->d_name;
+        if (*d < '0' || *d > '9') continue;
+
+        snprintf(path, sizeof(path), "/proc/%s/comm", d);
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) continue;  // exited since readdir
+        ssize_t n = read(fd, name, sizeof(name) - 1);
+        close(fd);
+        if (n <= 0) continue;
+        if (name[n - 1] == '\n') n--;
+
+        out.push_back({(pid_t)atoi(d), string(name, n)});
+    }
+    closedir(dir);
+}
+
+#ifdef __APPLE__
+//--------------------------------------------------------------
+void LibprocBackend::enumerate(vector<ProcessInfo>& out) {
+    out.clear();
+
+    // Ask for the count first, then leave headroom for processes started in between
+    int count = proc_listallpids(nullptr, 0);
+    if (count <= 0) return;
+    vector<pid_t> pids(count + 64);
+    count = proc_listallpids(pids.data(), (int)(pids.size() * sizeof(pid_t)));
+
+    char name[2 * MAXCOMLEN + 1];
+    for (int i = 0; i < count; i++) {
+        if (pids[i] <= 0) continue;
+        int n = proc_name(pids[i], name, sizeof(name));
+        if (n <= 0) continue;
+        out.push_back({pids[i], string(name, n)});
+    }
+}
+#endif
+
+//--------------------------------------------------------------
+ProcessTable::ProcessTable() {
+#ifdef __APPLE__
+    backend = make_unique<LibprocBackend>();
+#else
+    backend = make_unique<ProcfsBackend>();
+#endif
+}
+
+//--------------------------------------------------------------
+ProcessTable::ProcessTable(unique_ptr<ProcessTableBackend> backend)
+: backend(std::move(backend)) {
+}
+
+//--------------------------------------------------------------
+void ProcessTable::refresh() {
+    backend->enumerate(processes);
+
+    index.clear();
+    index.reserve(processes.size());
+    for (auto& p : processes) {
+        auto it = index.find(p.name);
+        if (it == index.end()) {
+            index.emplace(p.name, p.pid);
+        } else if (p.pid < it->second) {
+            it->second = p.pid;
+        }
+    }
+}
+
+//--------------------------------------------------------------
+string ProcessTable::lookupKey(const string& name) const {
+    size_t maxLength = backend->getMaxNameLength();
+    if (maxLength > 0 && name.length() > maxLength) {
+        return name.substr(0, maxLength);
+    }
+    return name;
+}
+
+//--------------------------------------------------------------
+bool ProcessTable::isRunning(const string& name) const {
+    return findPid(name) >= 0;
+}
+
+//--------------------------------------------------------------
+pid_t ProcessTable::findPid(const string& name) const {
+    auto it = index.find(lookupKey(name));
+    if (it == index.end()) {
+        return -1;
+    }
+    return it->second;
+}
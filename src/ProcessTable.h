@@ -0,0 +1,62 @@
+#pragma once
+
+#include "ofMain.h"
+#include <sys/types.h>
+
+struct ProcessInfo {
+    pid_t pid;
+    string name;
+};
+
+// Enumerates every running process in one pass. One implementation per
+// platform; the table itself does not care where the list comes from.
+class ProcessTableBackend {
+public:
+    virtual ~ProcessTableBackend() {}
+
+    // Replace 'out' with the current process list (reuse its storage)
+    virtual void enumerate(vector<ProcessInfo>& out) = 0;
+
+    // Longest name the platform reports (0 = no limit). Lookups are
+    // truncated the same way so long app names still match.
+    virtual size_t getMaxNameLength() const { return 0; }
+};
+
+// Linux: /proc/<pid>/comm
+class ProcfsBackend : public ProcessTableBackend {
+public:
+    void enumerate(vector<ProcessInfo>& out) override;
+    size_t getMaxNameLength() const override { return 15; }  // TASK_COMM_LEN - 1
+};
+
+#ifdef __APPLE__
+// macOS: proc_listallpids() + proc_name() from libproc
+class LibprocBackend : public ProcessTableBackend {
+public:
+    void enumerate(vector<ProcessInfo>& out) override;
+    size_t getMaxNameLength() const override { return 32; }  // 2 * MAXCOMLEN
+};
+#endif
+
+// Snapshot of the process table with a name -> PID hash index.
+// Call refresh() once per tick, then answer any number of lookups from the
+// index instead of forking a pgrep per app.
+class ProcessTable {
+public:
+    ProcessTable();  // platform default backend
+    explicit ProcessTable(unique_ptr<ProcessTableBackend> backend);
+
+    void refresh();
+
+    bool isRunning(const string& name) const;
+    pid_t findPid(const string& name) const;  // -1 if not running
+
+    size_t size() const { return processes.size(); }
+
+private:
+    string lookupKey(const string& name) const;
+
+    unique_ptr<ProcessTableBackend> backend;
+    vector<ProcessInfo> processes;
+    unordered_map<string, pid_t> index;  // lowest PID per name
+};
@@ -0,0 +1,184 @@
+#include "ProcessWorker.h"
+#include "ProcessLauncher.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Write end of the worker's wake pipe, for the SIGCHLD handler
+static volatile sig_atomic_t sigchldWakeFd = -1;
+
+//--------------------------------------------------------------
+static void onSigchld(int) {
+    int savedErrno = errno;
+    if (sigchldWakeFd >= 0) {
+        char byte = 'c';
+        ssize_t ignored = write(sigchldWakeFd, &byte, 1);
+        (void)ignored;
+    }
+    errno = savedErrno;
+}
+
+//--------------------------------------------------------------
+ProcessWorker::~ProcessWorker() {
+    if (isThreadRunning()) {
+        stop();
+        waitForThread(false);
+    }
+    if (wakePipe[0] >= 0) {
+        sigchldWakeFd = -1;
+        close(wakePipe[0]);
+        close(wakePipe[1]);
+    }
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::setup(function<void()> onEvent) {
+    this->onEvent = onEvent;
+
+    if (pipe(wakePipe) != 0) {
+        ofLogError("ProcessWorker") << "Can't create wake pipe: " << strerror(errno);
+        return;
+    }
+    for (int fd : wakePipe) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+
+    // Child exits wake the worker through the same pipe as new commands
+    sigchldWakeFd = wakePipe[1];
+    struct sigaction action = {};
+    action.sa_handler = onSigchld;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &action, nullptr);
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::stop() {
+    stopThread();
+    wakeWorker();
+}
+
+//--------------------------------------------------------------
+bool ProcessWorker::submit(const ProcessCommand& command) {
+    if (!commands.push(command)) {
+        ofLogError("ProcessWorker") << "Command queue full, dropping command for " << command.app.path;
+        return false;
+    }
+    wakeWorker();
+    return true;
+}
+
+//--------------------------------------------------------------
+bool ProcessWorker::poll(ProcessEvent& event) {
+    return events.pop(event);
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::wakeWorker() {
+    if (wakePipe[1] >= 0) {
+        char byte = 'w';
+        ssize_t ignored = write(wakePipe[1], &byte, 1);
+        (void)ignored;
+    }
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::threadedFunction() {
+    while (isThreadRunning()) {
+        // Sleep until a command arrives or a child exits. Retry soon if
+        // the scheduler hasn't made room for our events yet.
+        pollfd pfd = {wakePipe[0], POLLIN, 0};
+        ::poll(&pfd, 1, pendingEvents.empty() ? -1 : 10);
+
+        char drain[64];
+        while (read(wakePipe[0], drain, sizeof(drain)) > 0) {}
+
+        ProcessCommand command;
+        while (commands.pop(command)) {
+            execute(command);
+        }
+        reapChildren();
+        flushEvents();
+    }
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::execute(const ProcessCommand& command) {
+    auto now = chrono::steady_clock::now();
+
+    if (command.type == ProcessCommand::Launch) {
+        ProcessLauncher::Result result = ProcessLauncher::spawn(command.app);
+        if (result.pid < 0) {
+            emit({ProcessEvent::LaunchFailed, command.appIndex, command.app.path, -1, -1, 0, result.spawnMillis, result.error});
+            return;
+        }
+        children.push_back({Child::App, result.pid, command.appIndex, command.app.path, now});
+        emit({ProcessEvent::Launched, command.appIndex, command.app.path, result.pid, 0, 0, result.spawnMillis, ""});
+        return;
+    }
+
+    string error;
+    pid_t helper = ProcessLauncher::requestQuit(command.app, command.pid, error);
+    if (helper < 0) {
+        emit({ProcessEvent::QuitFailed, command.appIndex, command.app.path, command.pid, -1, 0, 0, error});
+    } else if (helper == 0) {
+        // Signal delivered, nothing to wait for
+        emit({ProcessEvent::Quit, command.appIndex, command.app.path, command.pid, 0, 0, 0, ""});
+    } else {
+        // Quit helper (osascript) runs in parallel with all the others
+        children.push_back({Child::QuitHelper, helper, command.appIndex, command.app.path, now});
+    }
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::reapChildren() {
+    for (size_t i = 0; i < children.size();) {
+        int status = 0;
+        pid_t result = waitpid(children[i].pid, &status, WNOHANG);
+        if (result == 0) {
+            i++;  // still running
+            continue;
+        }
+
+        const Child& child = children[i];
+        int exitCode = -1;
+        if (result > 0 && WIFEXITED(status)) {
+            exitCode = WEXITSTATUS(status);
+        } else if (result > 0 && WIFSIGNALED(status)) {
+            exitCode = 128 + WTERMSIG(status);
+        }
+        float seconds = chrono::duration<float>(chrono::steady_clock::now() - child.startTime).count();
+
+        if (child.kind == Child::App) {
+            emit({ProcessEvent::Exited, child.appIndex, child.appPath, child.pid, exitCode, seconds, 0, ""});
+        } else if (exitCode == 0) {
+            emit({ProcessEvent::Quit, child.appIndex, child.appPath, -1, exitCode, seconds, 0, ""});
+        } else {
+            emit({ProcessEvent::QuitFailed, child.appIndex, child.appPath, -1, exitCode, seconds, 0,
+                  "quit helper exited with " + ofToString(exitCode)});
+        }
+
+        children[i] = children.back();
+        children.pop_back();
+    }
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::emit(const ProcessEvent& event) {
+    pendingEvents.push_back(event);
+}
+
+//--------------------------------------------------------------
+void ProcessWorker::flushEvents() {
+    bool pushed = false;
+    while (!pendingEvents.empty() && events.push(pendingEvents.front())) {
+        pendingEvents.pop_front();
+        pushed = true;
+    }
+    if (pushed && onEvent) {
+        onEvent();
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ofMain.h"
+#include "AppEntry.h"
+#include "LockFreeQueue.h"
+#include <sys/types.h>
+
+struct ProcessCommand {
+    enum Type { Launch, Quit };
+    Type type;
+    int appIndex;
+    AppEntry app;
+    pid_t pid;          // Quit: the app's PID if known, else -1
+};
+
+struct ProcessEvent {
+    enum Type { Launched, LaunchFailed, Exited, Quit, QuitFailed };
+    Type type;
+    int appIndex;
+    string appPath;
+    pid_t pid;          // the app's PID (Launched, Exited)
+    int exitCode;       // Exited/Quit*: exit status (128+signal if killed), -1 if unknown
+    float seconds;      // Exited: uptime; Quit*: how long the quit took
+    double spawnMillis; // Launched: time spent in posix_spawn()
+    string message;     // error text for failures
+
+    bool failed() const { return type == LaunchFailed || type == QuitFailed; }
+};
+
+// Runs launch and quit commands off the scheduler thread.
+// Commands come in through a lock-free queue. Apps are spawned directly
+// (ProcessLauncher) and stay our children, so we see when they exit; quit
+// helpers run in parallel, so N quits finish when the slowest one does.
+// Completions, exits and failures go back through a second lock-free queue;
+// onEvent is called (on the worker thread) whenever there is something to
+// poll().
+class ProcessWorker : public ofThread {
+public:
+    ~ProcessWorker();
+
+    void setup(function<void()> onEvent);
+    void stop();
+
+    // Producer side (scheduler thread)
+    bool submit(const ProcessCommand& command);
+
+    // Consumer side (scheduler thread)
+    bool poll(ProcessEvent& event);
+
+protected:
+    void threadedFunction() override;
+
+private:
+    struct Child {
+        enum Kind { App, QuitHelper };
+        Kind kind;
+        pid_t pid;
+        int appIndex;
+        string appPath;
+        chrono::steady_clock::time_point startTime;
+    };
+
+    void execute(const ProcessCommand& command);
+    void reapChildren();
+    void emit(const ProcessEvent& event);
+    void flushEvents();
+    void wakeWorker();
+
+    SpscQueue<ProcessCommand> commands{256};
+    SpscQueue<ProcessEvent> events{256};
+    deque<ProcessEvent> pendingEvents;  // events not yet handed to the queue (worker only)
+    vector<Child> children;             // running apps and helpers (worker only)
+    function<void()> onEvent;
+    int wakePipe[2] = {-1, -1};
+};
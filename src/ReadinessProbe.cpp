@@ -0,0 +1,139 @@
+#include "ReadinessProbe.h"
+#include "AppEntry.h"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Read at most this much of a log per check; a chatty log is caught up on
+// over the next checks instead of stalling one
+static const off_t MAX_LOG_BYTES_PER_CHECK = 256 * 1024;
+
+//--------------------------------------------------------------
+bool ReadinessProbe::parse(const string& value, string& error) {
+    vector<string> words = splitArguments(value);
+    if (words.empty()) {
+        error = "empty probe";
+        return false;
+    }
+
+    const string& kind = words[0];
+    if (kind == "port" && words.size() == 2) {
+        port = ofToInt(words[1]);
+        if (port <= 0 || port > 65535) {
+            error = "invalid port '" + words[1] + "'";
+            return false;
+        }
+        type = Port;
+    } else if (kind == "file" && words.size() == 2) {
+        type = File;
+        path = words[1];
+    } else if (kind == "log" && words.size() == 3 && !words[2].empty()) {
+        type = LogLine;
+        path = words[1];
+        text = words[2];
+    } else {
+        error = "expected 'port N', 'file PATH' or 'log PATH TEXT'";
+        return false;
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+string ReadinessProbe::describe() const {
+    switch (type) {
+        case Port: return "port " + ofToString(port);
+        case File: return "file " + path;
+        case LogLine: return "log " + path + " \"" + text + "\"";
+        default: return "spawn";
+    }
+}
+
+//--------------------------------------------------------------
+void ReadinessCheck::start(const ReadinessProbe& probe) {
+    this->probe = probe;
+    logCarry.clear();
+    logOffset = 0;
+    startTime = time(0);
+
+    // Only lines written from now on count
+    struct stat st;
+    if (probe.type == ReadinessProbe::LogLine && stat(probe.path.c_str(), &st) == 0) {
+        logOffset = st.st_size;
+    }
+}
+
+//--------------------------------------------------------------
+bool ReadinessCheck::check() {
+    switch (probe.type) {
+        case ReadinessProbe::Port: return checkPort();
+        case ReadinessProbe::File: return checkFile();
+        case ReadinessProbe::LogLine: return checkLog();
+        default: return true;
+    }
+}
+
+//--------------------------------------------------------------
+bool ReadinessCheck::checkPort() {
+    // Don't leak the socket into an app the worker spawns meanwhile
+#ifdef SOCK_CLOEXEC
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return false;
+#else
+    // macOS has no SOCK_CLOEXEC: a spawn that lands between socket() and
+    // fcntl() can still inherit the socket (it's closed again right below)
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return false;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+
+    // Connecting to localhost succeeds or is refused right away
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)probe.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bool connected = connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0;
+    close(fd);
+    return connected;
+}
+
+//--------------------------------------------------------------
+bool ReadinessCheck::checkFile() {
+    // A file left over from the previous run (or a crash) doesn't count.
+    // Whole seconds, since some file systems store nothing finer.
+    struct stat st;
+    return stat(probe.path.c_str(), &st) == 0 && st.st_mtime >= startTime;
+}
+
+//--------------------------------------------------------------
+bool ReadinessCheck::checkLog() {
+    int fd = open(probe.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;  // not created yet
+
+    // Truncated or replaced by a new, shorter file: start over
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size < logOffset) {
+        logOffset = 0;
+        logCarry.clear();
+    }
+
+    bool found = false;
+    char buffer[4096];
+    off_t limit = logOffset + MAX_LOG_BYTES_PER_CHECK;
+    while (!found && logOffset < limit) {
+        ssize_t n = pread(fd, buffer, sizeof(buffer), logOffset);
+        if (n <= 0) break;
+        logOffset += n;
+
+        string chunk = logCarry + string(buffer, n);
+        found = chunk.find(probe.text) != string::npos;
+
+        // Keep just enough to match text split across two reads
+        size_t keep = min(chunk.size(), probe.text.size() - 1);
+        logCarry = chunk.substr(chunk.size() - keep);
+    }
+    close(fd);
+    return found;
+}
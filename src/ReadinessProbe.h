@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ofMain.h"
+#include <sys/types.h>
+
+// How to tell that a launched app is up, from a "ready:" line:
+//
+//   ready: port 6454                       (something accepts TCP connections on localhost)
+//   ready: file /tmp/artnet.pid            (the file exists)
+//   ready: log /Users/show/artnet.log "Listening on"   (a new log line contains the text)
+//
+// Without a probe an app counts as ready as soon as it has been spawned.
+struct ReadinessProbe {
+    enum Type { None, Port, File, LogLine };
+    Type type = None;
+    int port = 0;
+    string path;    // File, LogLine
+    string text;    // LogLine
+
+    // Parse the value of a "ready:" line; false (with a message) if malformed
+    bool parse(const string& value, string& error);
+    string describe() const;
+};
+
+// Checks one probe repeatedly. Only what happens after start() counts: log
+// files are read incrementally from there, and a ready file must have been
+// written since, so leftovers from the previous run don't fool us.
+class ReadinessCheck {
+public:
+    void start(const ReadinessProbe& probe);
+    bool check();
+
+private:
+    bool checkPort();
+    bool checkFile();
+    bool checkLog();
+
+    ReadinessProbe probe;
+    time_t startTime = 0;
+    off_t logOffset = 0;
+    string logCarry;    // end of the previous read, in case the text is split across reads
+};
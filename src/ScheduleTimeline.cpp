@@ -0,0 +1,101 @@
+#include "ScheduleTimeline.h"
+
+//--------------------------------------------------------------
+void ScheduleTimeline::compile(const bool schedule[NUM_DAYS][NUM_SLOTS], time_t from, int numDays) {
+    transitions.clear();
+
+    tm start;
+    localtime_r(&from, &start);
+
+    // Resolve every slot start in the window to an absolute time.
+    // Start one day early so there is always a slot at or before 'from'.
+    struct SlotTime {
+        time_t time;
+        bool active;
+        int day;
+        int slot;
+    };
+    vector<SlotTime> slots;
+    slots.reserve((numDays + 2) * NUM_SLOTS);
+
+    for (int dayOffset = -1; dayOffset <= numDays; dayOffset++) {
+        for (int s = 0; s < NUM_SLOTS; s++) {
+            tm t = {};
+            t.tm_year = start.tm_year;
+            t.tm_mon = start.tm_mon;
+            t.tm_mday = start.tm_mday + dayOffset;
+            t.tm_hour = s / 2;
+            t.tm_min = (s % 2) * 30;
+            t.tm_isdst = -1;  // let mktime decide (handles DST days)
+            time_t slotTime = mktime(&t);
+            if (slotTime == (time_t)-1) continue;
+
+            // mktime moves a time inside a DST gap forward; such a slot
+            // never happens on this day, so it can't cause a transition
+            if (t.tm_hour != s / 2 || t.tm_min != (s % 2) * 30) continue;
+
+            int dow = t.tm_wday;
+            int day = (dow == 0) ? 6 : dow - 1;
+
+            // Keep the list strictly increasing even if mktime disagrees
+            // with itself around an ambiguous (repeated) hour
+            if (!slots.empty() && slotTime <= slots.back().time) {
+                slotTime = slots.back().time;
+                slots.back() = {slotTime, schedule[day][s], day, s};
+                continue;
+            }
+            slots.push_back({slotTime, schedule[day][s], day, s});
+        }
+    }
+
+    // State at 'from' = last slot that started at or before it
+    size_t i = 0;
+    initialActive = false;
+    while (i < slots.size() && slots[i].time <= from) {
+        initialActive = slots[i].active;
+        i++;
+    }
+
+    // Keep only real changes
+    bool state = initialActive;
+    for (; i < slots.size(); i++) {
+        if (slots[i].active != state) {
+            state = slots[i].active;
+            transitions.push_back({slots[i].time, state, slots[i].day, slots[i].slot});
+        }
+    }
+
+    compiledFrom = from;
+    compiledUntil = slots.empty() ? from : slots.back().time;
+}
+
+//--------------------------------------------------------------
+bool ScheduleTimeline::isActiveAt(time_t t) const {
+    auto it = upper_bound(transitions.begin(), transitions.end(), t,
+                          [](time_t value, const ScheduleTransition& tr) { return value < tr.time; });
+    if (it == transitions.begin()) {
+        return initialActive;
+    }
+    return prev(it)->active;
+}
+
+//--------------------------------------------------------------
+const ScheduleTransition* ScheduleTimeline::nextTransitionAfter(time_t t) const {
+    auto it = upper_bound(transitions.begin(), transitions.end(), t,
+                          [](time_t value, const ScheduleTransition& tr) { return value < tr.time; });
+    if (it == transitions.end()) {
+        return nullptr;
+    }
+    return &(*it);
+}
+
+//--------------------------------------------------------------
+bool ScheduleTimeline::needsRecompile(time_t t) const {
+    return t < compiledFrom || t >= getRecompileTime();
+}
+
+//--------------------------------------------------------------
+time_t ScheduleTimeline::getRecompileTime() const {
+    // Always keep at least one full day of lookahead
+    return compiledUntil - 24 * 60 * 60;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ofMain.h"
+
+// One real ON/OFF change of the weekly grid, resolved to an absolute time
+struct ScheduleTransition {
+    time_t time;    // when the change happens
+    bool active;    // state from this time on
+    int day;        // 0=Mon ... 6=Sun (local)
+    int slot;       // 0-47
+};
+
+// The weekly schedule grid compiled into a sorted list of transition times.
+// Only slots where the state actually flips produce an entry, so the scheduler
+// can sleep from one entry to the next instead of polling every frame.
+// Slot start times are resolved with mktime() per calendar day, so DST days
+// (23h/25h) put every transition on the right wall-clock time.
+class ScheduleTimeline {
+public:
+    static const int NUM_DAYS = 7;
+    static const int NUM_SLOTS = 48;  // 24 hours * 2 (30-min slots)
+
+    // Compile transitions from 'from' for numDays calendar days ahead
+    void compile(const bool schedule[NUM_DAYS][NUM_SLOTS], time_t from, int numDays = 8);
+
+    // State at time t (t must lie inside the compiled window)
+    bool isActiveAt(time_t t) const;
+
+    // First transition strictly after t, or nullptr if none in the window
+    const ScheduleTransition* nextTransitionAfter(time_t t) const;
+
+    // True when t is outside the window or less than a day of lookahead is left
+    bool needsRecompile(time_t t) const;
+    time_t getRecompileTime() const;
+
+    const vector<ScheduleTransition>& getTransitions() const { return transitions; }
+
+private:
+    vector<ScheduleTransition> transitions;
+    bool initialActive = false;
+    time_t compiledFrom = 0;
+    time_t compiledUntil = 0;
+};
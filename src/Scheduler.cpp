@@ -0,0 +1,616 @@
+#include "Scheduler.h"
+
+// Upper bound for one sleep. Timed waits follow the wall clock on Linux, but
+// not everywhere, so this bounds how long a clock change can go unnoticed.
+static const int MAX_SLEEP_SECONDS = 60 * 60;
+
+// Wall and monotonic time may drift apart by this much between wakeups
+// before we treat it as a clock jump (NTP sync, manual change, system sleep)
+static const double CLOCK_JUMP_TOLERANCE = 5.0;
+
+// Supervisor: restart delay doubles per crash (1s, 2s, 4s ... 5min). An app
+// that stays up this long is considered stable and its streak is forgiven;
+// after this many crashes in a row we stop until the next ON transition.
+static const float RESTART_BACKOFF_MIN = 1.0;
+static const float RESTART_BACKOFF_MAX = 5 * 60.0;
+static const float RESTART_STABLE_SECONDS = 60.0;
+static const int CRASH_LOOP_LIMIT = 5;
+
+const string Scheduler::dayNames[NUM_DAYS] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+//--------------------------------------------------------------
+void Scheduler::setup() {
+    // Initialize schedule to all inactive (apps closed by default)
+    for (int d = 0; d < NUM_DAYS; d++) {
+        for (int s = 0; s < NUM_SLOTS; s++) {
+            schedule[d][s] = false;
+        }
+    }
+
+    // Load saved schedule if exists
+    loadSchedule();
+
+    // Load app list
+    loadAppList();
+
+    // Initialize state - don't assume apps are running; the first tick will
+    // start them if current time is in an active slot
+    appsCurrentlyRunning = false;
+    launchingApps = false;
+    wakeups = 0;
+
+    // Test mode - start disabled, use real time
+    time_t now = time(0);
+    tm lt;
+    localtime_r(&now, &lt);
+    testMode = false;
+    testSlot = getSlotOfDay(lt);
+    testDay = getDayOfWeek(lt);
+
+    compileTimeline(now);
+    needsEvaluation = true;
+
+    worker.setup([this] { wake(); });
+    worker.startThread();
+}
+
+//--------------------------------------------------------------
+void Scheduler::stop() {
+    stopThread();
+    wake();
+    worker.stop();
+    worker.waitForThread(false);
+}
+
+//--------------------------------------------------------------
+void Scheduler::wake() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::requestOpen() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        openRequested = true;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::requestClose() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        closeRequested = true;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::reloadSchedule() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        loadSchedule();
+        compileTimeline(time(0));
+        needsEvaluation = true;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::reloadAppList() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        loadAppList();
+        if (launchingApps) {
+            // Start over with the new list; apps already up count as ready
+            launch.start(apps, ofGetElapsedTimef());
+            launchingApps = launch.isActive();
+            appsCurrentlyRunning = !launchingApps && !apps.empty();
+        }
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::scheduleChanged() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        saveSchedule();
+        compileTimeline(time(0));
+        needsEvaluation = true;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::toggleTestMode() {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        testMode = !testMode;
+        if (testMode) {
+            // Initialize test time to current real time
+            time_t now = time(0);
+            tm lt;
+            localtime_r(&now, &lt);
+            testDay = getDayOfWeek(lt);
+            testSlot = getSlotOfDay(lt);
+            ofLog() << "TEST MODE ON - Use arrow keys to change time";
+        } else {
+            ofLog() << "TEST MODE OFF - Using real time";
+        }
+        // Re-evaluate with the new time source
+        needsEvaluation = true;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::stepTestTime(int dayDelta, int slotDelta) {
+    {
+        lock_guard<std::mutex> guard(mutex);
+        if (!testMode) return;
+        testDay = (testDay + dayDelta + NUM_DAYS) % NUM_DAYS;
+        testSlot = (testSlot + slotDelta + NUM_SLOTS) % NUM_SLOTS;
+        ofLog() << "Test time: " << dayNames[testDay] << " " << slotToTimeString(testSlot);
+        needsEvaluation = true;  // Force re-check
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------
+void Scheduler::loadSchedule() {
+    string path = ofToDataPath("schedule.json");
+    ofFile file(path);
+
+    if (file.exists()) {
+        ofJson json;
+        file >> json;
+
+        if (json.contains("schedule")) {
+            auto& sched = json["schedule"];
+            for (int d = 0; d < NUM_DAYS && d < sched.size(); d++) {
+                for (int s = 0; s < NUM_SLOTS && s < sched[d].size(); s++) {
+                    schedule[d][s] = sched[d][s].get<bool>();
+                }
+            }
+            ofLog() << "Loaded schedule from " << path;
+        }
+    } else {
+        ofLog() << "No schedule.json found, using defaults (all active)";
+        saveSchedule();  // Create default file
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::saveSchedule() {
+    ofJson json;
+
+    for (int d = 0; d < NUM_DAYS; d++) {
+        ofJson dayArray;
+        for (int s = 0; s < NUM_SLOTS; s++) {
+            dayArray.push_back(schedule[d][s]);
+        }
+        json["schedule"].push_back(dayArray);
+    }
+
+    string path = ofToDataPath("schedule.json");
+    ofFile file(path, ofFile::WriteOnly);
+    file << json.dump(2);
+    file.close();
+
+    ofLog() << "Saved schedule to " << path;
+}
+
+//--------------------------------------------------------------
+void Scheduler::loadAppList() {
+    string path = ofToDataPath("appsToControl.txt");
+    vector<AppEntry> loaded;
+
+    if (!loadAppEntries(path, loaded)) {
+        ofLogWarning() << "No appsToControl.txt found at " << path;
+    }
+
+    // Apps that are launched exactly the same way keep their running state
+    vector<AppState> states(loaded.size());
+    for (size_t i = 0; i < loaded.size(); i++) {
+        for (size_t j = 0; j < apps.size(); j++) {
+            if (loaded[i].sameLaunchAs(apps[j])) {
+                states[i] = appStates[j];
+                break;
+            }
+        }
+        ofLog() << "App to control: " << loaded[i].path << " (delay: " << loaded[i].delay << "s"
+                << (loaded[i].args.empty() ? "" : ", args: " + ofJoinString(loaded[i].args, " ")) << ")";
+    }
+    apps = loaded;
+    appStates = states;
+    ofLog() << "Loaded " << apps.size() << " apps from " << path;
+}
+
+//--------------------------------------------------------------
+int Scheduler::getDayOfWeek(const tm& t) {
+    int dow = t.tm_wday;  // 0=Sunday in C
+    // Convert to Mon=0, Sun=6
+    return (dow == 0) ? 6 : dow - 1;
+}
+
+//--------------------------------------------------------------
+int Scheduler::getSlotOfDay(const tm& t) {
+    return t.tm_hour * 2 + (t.tm_min >= 30 ? 1 : 0);
+}
+
+//--------------------------------------------------------------
+string Scheduler::slotToTimeString(int slot) {
+    int hour = slot / 2;
+    int minute = (slot % 2) * 30;
+    char buffer[6];
+    sprintf(buffer, "%02d:%02d", hour, minute);
+    return string(buffer);
+}
+
+//--------------------------------------------------------------
+bool Scheduler::isAppRunning(int appIndex) {
+    return findAppPid(appIndex) > 0;
+}
+
+//--------------------------------------------------------------
+pid_t Scheduler::findAppPid(int appIndex) {
+    if (appStates[appIndex].pid > 0) {
+        return appStates[appIndex].pid;
+    }
+    return processTable.findPid(apps[appIndex].name);
+}
+
+//--------------------------------------------------------------
+int Scheduler::findApp(int appIndex, const string& appPath) const {
+    // The app list may have been reloaded since the command was sent
+    if (appIndex >= 0 && appIndex < (int)apps.size() && apps[appIndex].path == appPath) {
+        return appIndex;
+    }
+    for (int i = 0; i < (int)apps.size(); i++) {
+        if (apps[i].path == appPath) return i;
+    }
+    return -1;
+}
+
+//--------------------------------------------------------------
+void Scheduler::startLaunchSequence() {
+    if (apps.empty()) return;
+
+    // A new ACTIVE period: give crash-looping apps another chance
+    for (auto& state : appStates) {
+        state.crashStreak = 0;
+        state.gaveUp = false;
+        state.restartPending = false;
+    }
+
+    ofLog() << "Starting apps...";
+    launch.start(apps, ofGetElapsedTimef());
+    launchingApps = true;
+}
+
+//--------------------------------------------------------------
+void Scheduler::quitApps() {
+    // Closing cancels any launch still counting down
+    launch.cancel();
+    launchingApps = false;
+    if (apps.empty()) return;
+
+    // All quit requests go out at once; the worker reports back per app
+    ofLog() << "Closing apps...";
+    processTable.refresh();
+    for (int i = 0; i < (int)apps.size(); i++) {
+        appStates[i].quitRequested = true;
+        appStates[i].restartPending = false;
+        worker.submit({ProcessCommand::Quit, i, apps[i], findAppPid(i)});
+    }
+    appsCurrentlyRunning = false;
+}
+
+//--------------------------------------------------------------
+void Scheduler::handleProcessEvent(ProcessEvent& event) {
+    int i = findApp(event.appIndex, event.appPath);
+
+    switch (event.type) {
+        case ProcessEvent::Launched:
+            ofLog() << "Spawned " << event.appPath << " (pid " << event.pid << ") in " << event.spawnMillis << " ms";
+            if (i >= 0) {
+                appStates[i].pid = event.pid;
+                launch.launched(i, ofGetElapsedTimef());
+            }
+            break;
+        case ProcessEvent::LaunchFailed:
+            ofLogWarning("Scheduler") << "Failed to open " << event.appPath << ": " << event.message;
+            if (i >= 0) launch.launchFailed(i, ofGetElapsedTimef());
+            break;
+        case ProcessEvent::Exited:
+            ofLog() << event.appPath << " (pid " << event.pid << ") exited with " << event.exitCode
+                    << " after " << event.seconds << "s";
+            if (i >= 0 && appStates[i].pid == event.pid) {
+                appStates[i].pid = -1;
+                superviseExit(i, event);
+            }
+            break;
+        case ProcessEvent::Quit:
+            ofLog() << "Quit " << event.appPath << " (" << event.seconds << "s)";
+            break;
+        case ProcessEvent::QuitFailed:
+            ofLogWarning("Scheduler") << "Failed to quit " << event.appPath << ": " << event.message;
+            break;
+    }
+    ofNotifyEvent(processEvent, event, this);
+}
+
+//--------------------------------------------------------------
+bool Scheduler::shouldAppRun(int appIndex) const {
+    if (appStates[appIndex].quitRequested) return false;
+    return appsCurrentlyRunning || (launchingApps && launch.hasStarted(appIndex));
+}
+
+//--------------------------------------------------------------
+void Scheduler::launchApp(int appIndex) {
+    appStates[appIndex].quitRequested = false;
+    worker.submit({ProcessCommand::Launch, appIndex, apps[appIndex], -1});
+}
+
+//--------------------------------------------------------------
+void Scheduler::superviseExit(int appIndex, const ProcessEvent& event) {
+    AppState& state = appStates[appIndex];
+    if (!shouldAppRun(appIndex)) {
+        return;  // expected: we closed it, or it's dark anyway
+    }
+
+    // A long run in between means this is a fresh problem, not a loop
+    if (event.seconds >= RESTART_STABLE_SECONDS) {
+        state.crashStreak = 0;
+    }
+    state.crashStreak++;
+
+    if (state.crashStreak > CRASH_LOOP_LIMIT) {
+        state.gaveUp = true;
+        ofLogError("Scheduler") << apps[appIndex].name << " crashed " << state.crashStreak
+                                << " times in a row, not restarting until the next ON transition";
+        return;
+    }
+
+    float backoff = min(RESTART_BACKOFF_MAX, RESTART_BACKOFF_MIN * powf(2, state.crashStreak - 1));
+    state.restartPending = true;
+    state.restartTime = ofGetElapsedTimef() + backoff;
+    ofLogWarning("Scheduler") << apps[appIndex].name << " died during an ACTIVE slot (exit " << event.exitCode
+                              << "), restarting in " << backoff << "s";
+}
+
+//--------------------------------------------------------------
+void Scheduler::tickRestarts() {
+    float now = ofGetElapsedTimef();
+    for (int i = 0; i < (int)apps.size(); i++) {
+        AppState& state = appStates[i];
+        if (!state.restartPending || now < state.restartTime) continue;
+
+        state.restartPending = false;
+        if (!shouldAppRun(i)) continue;
+
+        state.restartCount++;
+        ofLog() << "Restarting " << apps[i].path << " (restart #" << state.restartCount << ")";
+        launchApp(i);
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::threadedFunction() {
+    unique_lock<std::mutex> lck(mutex);
+    lastWallTime = time(0);
+    lastSteadyTime = chrono::steady_clock::now();
+
+    while (isThreadRunning()) {
+        wakeups++;
+        wakeRequested = false;
+        tick();
+        if (!isThreadRunning()) break;
+
+        // Sleep until the next transition/launch deadline or until woken
+        auto deadline = nextWakeDeadline(time(0));
+        wakeCondition.wait_until(lck, deadline, [this] { return wakeRequested || !isThreadRunning(); });
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::tick() {
+    time_t now = time(0);
+
+    // Wall and monotonic time should advance together between wakeups.
+    // If they don't, the clock was changed: rebuild the timeline from scratch.
+    auto steadyNow = chrono::steady_clock::now();
+    double steadyDelta = chrono::duration<double>(steadyNow - lastSteadyTime).count();
+    double wallDelta = difftime(now, lastWallTime);
+    if (fabs(wallDelta - steadyDelta) > CLOCK_JUMP_TOLERANCE) {
+        ofLogWarning("Scheduler") << "Wall clock jumped by " << (wallDelta - steadyDelta) << "s, recompiling timeline";
+        compileTimeline(now);
+        needsEvaluation = true;
+    }
+    lastWallTime = now;
+    lastSteadyTime = steadyNow;
+
+    ProcessEvent event;
+    while (worker.poll(event)) {
+        handleProcessEvent(event);
+    }
+
+    if (closeRequested) {
+        closeRequested = false;
+        quitApps();
+    }
+    if (openRequested) {
+        openRequested = false;
+        startLaunchSequence();
+    }
+
+    tickRestarts();
+
+    if (timeline.needsRecompile(now)) {
+        compileTimeline(now);
+    }
+
+    // Transitions are evaluated during a launch too, so an OFF slot stops it
+    bool transitionDue = !testMode && hasNextTransition && now >= nextTransition.time;
+    if (needsEvaluation || transitionDue) {
+        evaluate(now);
+    }
+
+    // After evaluate(), so a sequence it just started gets going right away
+    if (launchingApps) {
+        tickLaunch();
+        // Every app is ready: check the schedule again
+        if (!launchingApps && needsEvaluation) {
+            evaluate(now);
+        }
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::runUnlocked(const function<void()>& work) {
+    // Only called from the thread, which holds the lock through tick()
+    mutex.unlock();
+    work();
+    mutex.lock();
+}
+
+//--------------------------------------------------------------
+void Scheduler::tickLaunch() {
+    // Readiness probes that are due, checked without the lock
+    vector<LaunchPipeline::PendingProbe> probes;
+    launch.takeProbes(ofGetElapsedTimef(), probes);
+    if (!probes.empty()) {
+        runUnlocked([&probes] {
+            for (auto& probe : probes) {
+                probe.ready = probe.check.check();
+            }
+        });
+        launch.putProbes(probes, ofGetElapsedTimef());
+        if (!launchingApps) return;  // closed meanwhile
+    }
+
+    // Launch every app whose prerequisites are ready and whose delay has run out.
+    // At most one process table scan per tick answers every isAppRunning() below
+    bool scanned = false;
+    vector<int> due;
+
+    while (true) {
+        launch.update(ofGetElapsedTimef(), due);
+        if (due.empty()) break;
+
+        if (!scanned) {
+            processTable.refresh();
+            scanned = true;
+        }
+        for (int i : due) {
+            if (isAppRunning(i)) {
+                launch.alreadyRunning(i, ofGetElapsedTimef());
+            } else {
+                ofLog() << "  [" << apps[i].delay << "s] Opening " << apps[i].path;
+                launch.launching(i, ofGetElapsedTimef());
+                launchApp(i);
+            }
+        }
+    }
+
+    if (!launch.isActive()) {
+        launchingApps = false;
+        appsCurrentlyRunning = true;
+        needsEvaluation = true;
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::evaluate(time_t now) {
+    needsEvaluation = false;
+
+    int currentDay;
+    int currentSlot;
+    bool shouldBeActive;
+    if (testMode) {
+        currentDay = testDay;
+        currentSlot = testSlot;
+        shouldBeActive = schedule[currentDay][currentSlot];
+    } else {
+        tm lt;
+        localtime_r(&now, &lt);
+        currentDay = getDayOfWeek(lt);
+        currentSlot = getSlotOfDay(lt);
+        shouldBeActive = timeline.isActiveAt(now);
+    }
+    updateNextTransition(now);
+
+    ofLog() << dayNames[currentDay] << " " << slotToTimeString(currentSlot)
+            << " - Slot active: " << (shouldBeActive ? "YES" : "NO")
+            << " - Apps running: " << (appsCurrentlyRunning ? "YES" : "NO");
+
+    if (shouldBeActive && !appsCurrentlyRunning && !launchingApps) {
+        startLaunchSequence();
+    } else if (!shouldBeActive && (appsCurrentlyRunning || launchingApps)) {
+        // Also stops a launch that is still waiting on delays or probes
+        quitApps();
+    }
+}
+
+//--------------------------------------------------------------
+void Scheduler::compileTimeline(time_t now) {
+    timeline.compile(schedule, now);
+    updateNextTransition(now);
+    ofLogVerbose("Scheduler") << "Compiled " << timeline.getTransitions().size() << " transitions";
+}
+
+//--------------------------------------------------------------
+void Scheduler::updateNextTransition(time_t now) {
+    const ScheduleTransition* next = timeline.nextTransitionAfter(now);
+    hasNextTransition = (next != nullptr);
+    if (next) {
+        nextTransition = *next;
+    }
+}
+
+//--------------------------------------------------------------
+chrono::system_clock::time_point Scheduler::nextWakeDeadline(time_t now) {
+    using namespace chrono;
+    auto deadline = system_clock::now() + seconds(MAX_SLEEP_SECONDS);
+
+    // Relative deadlines, rounded up so we don't wake a hair early and spin on the boundary
+    float elapsed = ofGetElapsedTimef();
+    auto in = [](float remaining) {
+        return system_clock::now() + milliseconds((long long)ceil(max(0.0f, remaining) * 1000) + 1);
+    };
+
+    // Next delay running out or probe to retry
+    float launchCheck = launchingApps ? launch.secondsUntilNextCheck(elapsed) : -1;
+    if (launchCheck >= 0) {
+        deadline = min(deadline, in(launchCheck));
+    }
+
+    // Earliest pending restart
+    for (auto& state : appStates) {
+        if (state.restartPending) {
+            deadline = min(deadline, in(state.restartTime - elapsed));
+        }
+    }
+
+    if (!testMode) {
+        // Absolute wall-clock deadlines, so a timed wait that follows the
+        // realtime clock fires at the right moment even after a clock change
+        if (hasNextTransition) {
+            deadline = min(deadline, system_clock::from_time_t(nextTransition.time));
+        }
+        deadline = min(deadline, system_clock::from_time_t(timeline.getRecompileTime()));
+    }
+    return deadline;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ScheduleTimeline.h"
+#include "ProcessTable.h"
+#include "ProcessWorker.h"
+#include "LaunchPipeline.h"
+
+// Runs the open/close logic on its own thread. Instead of checking the clock
+// every frame it compiles the grid into a ScheduleTimeline and sleeps until
+// the next real transition (or the next launch step). The UI and other
+// threads wake it up with wake() after changing something.
+// Launching and quitting is handed to a ProcessWorker, so neither this
+// thread nor the UI ever waits for a child process.
+//
+// Everything marked "guarded" must only be touched between lock()/unlock().
+class Scheduler : public ofThread {
+
+public:
+    static const int NUM_DAYS = ScheduleTimeline::NUM_DAYS;
+    static const int NUM_SLOTS = ScheduleTimeline::NUM_SLOTS;
+
+    void setup();
+    void stop();     // stop the threads and wake them so they exit promptly
+    void wake();     // re-evaluate now
+
+    // Thread-safe requests (used by keyboard shortcuts)
+    void requestOpen();
+    void requestClose();
+    void reloadSchedule();
+    void reloadAppList();
+    void scheduleChanged();   // grid was edited: save, recompile and re-check
+    void toggleTestMode();
+    void stepTestTime(int dayDelta, int slotDelta);
+
+    // Schedule grid: 7 days x 48 half-hour slots (guarded)
+    // true = ACTIVE (apps run), false = INACTIVE (darkness, apps closed)
+    bool schedule[NUM_DAYS][NUM_SLOTS];
+
+    // App control (guarded)
+    struct AppState {
+        pid_t pid = -1;             // our child while it runs, -1 otherwise
+        bool quitRequested = false; // we asked it to quit, so an exit is expected
+
+        // Supervisor: restart apps that die while they should be running
+        int restartCount = 0;       // restarts since the scheduler started
+        int crashStreak = 0;        // crashes without a stable run in between
+        bool restartPending = false;
+        float restartTime = 0;      // ofGetElapsedTimef() when to restart
+        bool gaveUp = false;        // crash loop: wait for the next ON transition
+    };
+    vector<AppEntry> apps;      // from appsToControl.txt
+    vector<AppState> appStates; // parallel to apps
+    bool appsCurrentlyRunning;
+
+    // Launch sequence with progress bars (guarded)
+    bool launchingApps;     // true until every app is ready (or failed)
+    LaunchPipeline launch;  // per-app stage: waiting, delay countdown, starting, probing, ready
+
+    // Test mode - override current time for testing (guarded)
+    bool testMode;
+    int testSlot;
+    int testDay;
+
+    // Next real ON/OFF change in the compiled window (guarded)
+    bool hasNextTransition;
+    ScheduleTransition nextTransition;
+
+    // Number of times the thread woke up since start (guarded)
+    uint64_t wakeups;
+
+    // Launch/quit completions and failures, notified on the scheduler thread
+    // with the scheduler locked (listeners must not call back into it)
+    ofEvent<ProcessEvent> processEvent;
+
+    // Schedule file I/O (call with the lock held)
+    void loadSchedule();
+    void saveSchedule();
+    void loadAppList();
+
+    // Time helpers
+    static int getDayOfWeek(const tm& t);   // 0=Mon, 1=Tue, ... 6=Sun
+    static int getSlotOfDay(const tm& t);   // 0-47
+    static string slotToTimeString(int slot);
+    static const string dayNames[NUM_DAYS];
+
+    // Our own child PID, else answered from processTable (refresh it once per tick first)
+    bool isAppRunning(int appIndex);
+    pid_t findAppPid(int appIndex);
+
+    // Whether the app is supposed to be up right now (already launched in an ACTIVE period)
+    bool shouldAppRun(int appIndex) const;
+
+protected:
+    void threadedFunction() override;
+
+private:
+    void tick();
+    void tickLaunch();
+    void evaluate(time_t now);
+    void compileTimeline(time_t now);
+    void updateNextTransition(time_t now);
+    chrono::system_clock::time_point nextWakeDeadline(time_t now);
+    void startLaunchSequence();
+    void quitApps();
+    void handleProcessEvent(ProcessEvent& event);
+    void superviseExit(int appIndex, const ProcessEvent& event);
+    void tickRestarts();
+    void launchApp(int appIndex);
+    int findApp(int appIndex, const string& appPath) const;
+
+    // Drop the lock around slow work (I/O, process scans) so the UI, which
+    // takes it every frame, never waits for it. Guarded state may change
+    // meanwhile: re-check anything read before.
+    void runUnlocked(const function<void()>& work);
+
+    ScheduleTimeline timeline;
+    ProcessTable processTable;
+    ProcessWorker worker;
+    condition_variable wakeCondition;
+    bool wakeRequested = false;
+    bool needsEvaluation = true;
+    bool openRequested = false;
+    bool closeRequested = false;
+
+    // Wall clock vs monotonic clock at the last wakeup, to detect clock jumps
+    time_t lastWallTime = 0;
+    chrono::steady_clock::time_point lastSteadyTime;
+};
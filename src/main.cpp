@@ -1,9 +1,47 @@
 #include "ofMain.h"
 #include "ofApp.h"
+#include "Scheduler.h"
+#include "Benchmarks.h"
 #include <GLFW/glfw3.h>
+#include <signal.h>
 
 //========================================================================
-int main( ){
+// Headless: no window, no GL context and no frame loop. The scheduler thread
+// sleeps until the next transition; the main thread just waits for a signal.
+static int runHeadless() {
+	ofInit();
+
+	// Block SIGINT/SIGTERM before starting threads so only sigwait() sees them
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+	Scheduler scheduler;
+	scheduler.setup();
+	scheduler.startThread();
+
+	int sig = 0;
+	sigwait(&signals, &sig);
+	ofLog() << "Received signal " << sig << ", stopping scheduler";
+
+	scheduler.stop();
+	scheduler.waitForThread(false);
+	return 0;
+}
+
+//========================================================================
+int main(int argc, char* argv[]){
+	for (int i = 1; i < argc; i++) {
+		if (string(argv[i]) == "--headless") {
+			return runHeadless();
+		}
+		if (string(argv[i]) == "--benchmark") {
+			return Benchmarks::run(i + 1 < argc ? argv[i + 1] : "all");
+		}
+	}
+
 	ofSetupOpenGL(800,240,OF_WINDOW);			// <-------- setup the GL context
 
 	// this kicks off the running of my app
@@ -32,235 +32,53 @@ void ofApp::setup() {
     ofSetWindowShape(windowWidth, windowHeight);
     ofSetWindowTitle("onOFFonAGAIN");
     
-    // Initialize schedule to all inactive (apps closed by default)
-    for (int d = 0; d < NUM_DAYS; d++) {
-        for (int s = 0; s < NUM_SLOTS; s++) {
-            schedule[d][s] = false;
-        }
-    }
+    // Load schedule and app list, then let the scheduler thread take over.
+    // It starts the apps if current time matches an active slot (using
+    // delays from appsToControl.txt) and sleeps until the next transition.
+    scheduler.setup();
+    ofAddListener(scheduler.processEvent, this, &ofApp::onProcessEvent);
+    scheduler.startThread();
     
-    // Load saved schedule if exists
-    loadSchedule();
+    displayValidUntil = 0;
+    updateDisplayTime();
     
-    // Load app list
-    loadAppList();
-    
-    // Initialize state - don't assume apps are running; update() will start them
-    // if current time matches an active slot (using delays from appsToControl.txt)
-    appsCurrentlyRunning = false;
-    lastCheckedSlot = -1;
-    lastCheckedDay = -1;
-    
-    // Test mode - start disabled, use real time
-    testMode = false;
-    testSlot = getCurrentSlot();
-    testDay = getCurrentDay();
+    lastDragDay = -1;
+    lastDragSlot = -1;
     
     // Message area
     noticeMessage = "";
     noticeStartTime = 0;
     noticeDuration = 5.0;  // Show notices for 5 seconds
     
-    // Sequential launch with progress bars
-    launchingApps = false;
-    launchIndex = 0;
-    launchStartTime = 0;
-    
     ofSetFrameRate(60);  // Smooth UI responsiveness
 }
 
 //--------------------------------------------------------------
-void ofApp::loadSchedule() {
-    string path = ofToDataPath("schedule.json");
-    ofFile file(path);
-    
-    if (file.exists()) {
-        ofJson json;
-        file >> json;
-        
-        if (json.contains("schedule")) {
-            auto& sched = json["schedule"];
-            for (int d = 0; d < NUM_DAYS && d < sched.size(); d++) {
-                for (int s = 0; s < NUM_SLOTS && s < sched[d].size(); s++) {
-                    schedule[d][s] = sched[d][s].get<bool>();
-                }
-            }
-            ofLog() << "Loaded schedule from " << path;
-        }
-    } else {
-        ofLog() << "No schedule.json found, using defaults (all active)";
-        saveSchedule();  // Create default file
-    }
-}
-
-//--------------------------------------------------------------
-void ofApp::saveSchedule() {
-    ofJson json;
-    
-    for (int d = 0; d < NUM_DAYS; d++) {
-        ofJson dayArray;
-        for (int s = 0; s < NUM_SLOTS; s++) {
-            dayArray.push_back(schedule[d][s]);
-        }
-        json["schedule"].push_back(dayArray);
-    }
-    
-    string path = ofToDataPath("schedule.json");
-    ofFile file(path, ofFile::WriteOnly);
-    file << json.dump(2);
-    file.close();
-    
-    ofLog() << "Saved schedule to " << path;
+void ofApp::exit() {
+    scheduler.stop();
+    scheduler.waitForThread(false);
+    ofRemoveListener(scheduler.processEvent, this, &ofApp::onProcessEvent);
 }
 
 //--------------------------------------------------------------
-void ofApp::loadAppList() {
-    appPaths.clear();
-    appDelays.clear();
-    
-    string path = ofToDataPath("appsToControl.txt");
-    ofFile file(path);
-    
-    if (file.exists()) {
-        ofBuffer buffer = file.readToBuffer();
-        
-        for (auto& line : buffer.getLines()) {
-            string trimmed = line;
-            // Trim whitespace
-            trimmed.erase(0, trimmed.find_first_not_of(" \t\n\r"));
-            trimmed.erase(trimmed.find_last_not_of(" \t\n\r") + 1);
-            
-            if (trimmed.length() > 0 && trimmed[0] != '#') {
-                // Parse format: "delay, /path/to/app" or just "/path/to/app"
-                int delay = 0;
-                string appPath = trimmed;
-                
-                size_t commaPos = trimmed.find(',');
-                if (commaPos != string::npos) {
-                    // Has delay prefix
-                    string delayStr = trimmed.substr(0, commaPos);
-                    delay = ofToInt(delayStr);
-                    appPath = trimmed.substr(commaPos + 1);
-                    // Trim whitespace from path
-                    appPath.erase(0, appPath.find_first_not_of(" \t"));
-                    appPath.erase(appPath.find_last_not_of(" \t\n\r") + 1);
-                }
-                
-                appPaths.push_back(appPath);
-                appDelays.push_back(delay);
-                ofLog() << "App to control: " << appPath << " (delay: " << delay << "s)";
-            }
-        }
-        ofLog() << "Loaded " << appPaths.size() << " apps from " << path;
-    } else {
-        ofLogWarning() << "No appsToControl.txt found at " << path;
-    }
-}
-
-//--------------------------------------------------------------
-int ofApp::getCurrentDay() {
-    // Return test day if in test mode
-    if (testMode) {
-        return testDay;
-    }
-    // Get current day of week (0=Mon, 6=Sun)
+void ofApp::updateDisplayTime() {
+    // One time() per frame; localtime() only when a half-hour boundary is
+    // crossed (or the clock was set back)
     time_t now = time(0);
-    tm* ltm = localtime(&now);
-    int dow = ltm->tm_wday;  // 0=Sunday in C
-    // Convert to Mon=0, Sun=6
-    return (dow == 0) ? 6 : dow - 1;
-}
-
-//--------------------------------------------------------------
-int ofApp::getCurrentSlot() {
-    // Return test slot if in test mode
-    if (testMode) {
-        return testSlot;
-    }
-    // Get current 30-min slot (0-47)
-    time_t now = time(0);
-    tm* ltm = localtime(&now);
-    int hour = ltm->tm_hour;
-    int minute = ltm->tm_min;
-    return hour * 2 + (minute >= 30 ? 1 : 0);
-}
-
-//--------------------------------------------------------------
-string ofApp::slotToTimeString(int slot) {
-    int hour = slot / 2;
-    int minute = (slot % 2) * 30;
-    char buffer[6];
-    sprintf(buffer, "%02d:%02d", hour, minute);
-    return string(buffer);
-}
-
-//--------------------------------------------------------------
-bool ofApp::isAppRunning(const string& appPath) {
-    // Extract app name from path
-    string appName = appPath;
-    
-    // Remove .app extension if present
-    size_t appPos = appName.rfind(".app");
-    if (appPos != string::npos) {
-        appName = appName.substr(0, appPos);
-    }
-    
-    // Get just the app name (last component of path)
-    size_t lastSlash = appName.rfind('/');
-    if (lastSlash != string::npos) {
-        appName = appName.substr(lastSlash + 1);
-    }
+    if (now < displayValidUntil && now >= displayValidUntil - 30 * 60) return;
     
-    // Use pgrep to check if app is running
-    string command = "pgrep -x \"" + appName + "\" > /dev/null 2>&1";
-    int result = system(command.c_str());
-    return (result == 0);
-}
-
-//--------------------------------------------------------------
-void ofApp::openApps() {
-    if (appPaths.empty()) return;
-    
-    // Start sequential launch so we can show progress bars for each app's delay
-    ofLog() << "Starting apps (with progress bars for each delay)...";
-    launchingApps = true;
-    launchIndex = 0;
-    launchStartTime = ofGetElapsedTimef();
-}
-
-//--------------------------------------------------------------
-void ofApp::closeApps() {
-    if (appPaths.empty()) return;
-    
-    ofLog() << "Closing apps...";
-    for (auto& appPath : appPaths) {
-        // Extract app name from path for quit command
-        string appName = appPath;
-        
-        // Remove .app extension if present
-        size_t appPos = appName.rfind(".app");
-        if (appPos != string::npos) {
-            appName = appName.substr(0, appPos);
-        }
-        
-        // Get just the app name (last component of path)
-        size_t lastSlash = appName.rfind('/');
-        if (lastSlash != string::npos) {
-            appName = appName.substr(lastSlash + 1);
-        }
-        
-        // Use osascript to quit the app gracefully
-        string command = "osascript -e 'tell application \"" + appName + "\" to quit'";
-        ofLog() << "  " << command;
-        system(command.c_str());
-    }
-    appsCurrentlyRunning = false;
+    tm lt;
+    localtime_r(&now, &lt);
+    displayDay = Scheduler::getDayOfWeek(lt);
+    displaySlot = Scheduler::getSlotOfDay(lt);
+    displayValidUntil = now + (30 - lt.tm_min % 30) * 60 - lt.tm_sec;
 }
 
 //--------------------------------------------------------------
 string ofApp::findGapsInSchedule(int day) {
-    // Find gaps in the ON schedule for a given day
+    // Find gaps in the ON schedule for a given day (call with scheduler locked)
     // A gap is 1-2 consecutive OFF slots surrounded by ON slots
+    const auto& schedule = scheduler.schedule;
     
     vector<pair<int, int>> gaps;  // pairs of (startSlot, count)
     
@@ -283,10 +101,10 @@ string ofApp::findGapsInSchedule(int day) {
     }
     
     // Build message
-    string msg = "NOTICE: " + dayNames[day] + " has gaps:\n";
+    string msg = "NOTICE: " + Scheduler::dayNames[day] + " has gaps:\n";
     for (auto& gap : gaps) {
-        string startTime = slotToTimeString(gap.first);
-        string endTime = slotToTimeString(gap.first + gap.second);
+        string startTime = Scheduler::slotToTimeString(gap.first);
+        string endTime = Scheduler::slotToTimeString(gap.first + gap.second);
         int minutes = gap.second * 30;
         msg += "  " + startTime + "-" + endTime + " (" + ofToString(minutes) + "min gap)\n";
     }
@@ -297,60 +115,38 @@ string ofApp::findGapsInSchedule(int day) {
 
 //--------------------------------------------------------------
 void ofApp::checkForGaps(int day) {
+    scheduler.lock();
     string gapMsg = findGapsInSchedule(day);
+    scheduler.unlock();
     if (!gapMsg.empty()) {
-        noticeMessage = gapMsg;
-        noticeStartTime = ofGetElapsedTimef();
+        showNotice(gapMsg);
     }
 }
 
 //--------------------------------------------------------------
-void ofApp::update() {
-    // Tick sequential launch: when delay for current app elapsed, open it and advance
-    if (launchingApps && launchIndex < (int)appPaths.size()) {
-        float elapsed = ofGetElapsedTimef() - launchStartTime;
-        int delay = appDelays[launchIndex];
-        if (elapsed >= (float)delay) {
-            string appPath = appPaths[launchIndex];
-            if (!isAppRunning(appPath)) {
-                string command = "open \"" + appPath + "\"";
-                ofLog() << "  [" << delay << "s] Opening " << appPath;
-                system(command.c_str());
-            }
-            launchIndex++;
-            if (launchIndex >= (int)appPaths.size()) {
-                launchingApps = false;
-                appsCurrentlyRunning = true;
-                ofLog() << "All apps started.";
-            } else {
-                launchStartTime = ofGetElapsedTimef();
-            }
-        }
-        // else: still counting down for current app (progress bar drawn in draw)
-    } else {
-        // Normal schedule check when slot or day changes
-        int currentDay = getCurrentDay();
-        int currentSlot = getCurrentSlot();
-        
-        if (currentSlot != lastCheckedSlot || currentDay != lastCheckedDay) {
-            lastCheckedSlot = currentSlot;
-            lastCheckedDay = currentDay;
-            
-            bool shouldBeActive = schedule[currentDay][currentSlot];
-            
-            ofLog() << dayNames[currentDay] << " " << slotToTimeString(currentSlot) 
-                    << " - Slot active: " << (shouldBeActive ? "YES" : "NO")
-                    << " - Apps running: " << (appsCurrentlyRunning ? "YES" : "NO");
-            
-            if (shouldBeActive && !appsCurrentlyRunning && !launchingApps) {
-                openApps();
-            } else if (!shouldBeActive && appsCurrentlyRunning) {
-                closeApps();
-            }
-        }
+void ofApp::showNotice(const string& message) {
+    lock_guard<std::mutex> guard(noticeMutex);
+    noticeMessage = message;
+    noticeStartTime = ofGetElapsedTimef();
+}
+
+//--------------------------------------------------------------
+void ofApp::onProcessEvent(ProcessEvent& event) {
+    // Runs on the scheduler thread: only surface failures
+    if (event.type == ProcessEvent::LaunchFailed) {
+        showNotice("Failed to open " + appNameFromPath(event.appPath) + ":\n  " + event.message);
+    } else if (event.type == ProcessEvent::QuitFailed) {
+        showNotice("Failed to quit " + appNameFromPath(event.appPath) + ":\n  " + event.message);
     }
+}
+
+//--------------------------------------------------------------
+void ofApp::update() {
+    // Opening/closing happens on the scheduler thread; only UI state here
+    updateDisplayTime();
     
     // Clear notice after duration
+    lock_guard<std::mutex> guard(noticeMutex);
     if (!noticeMessage.empty() && (ofGetElapsedTimef() - noticeStartTime) > noticeDuration) {
         noticeMessage = "";
     }
@@ -358,8 +154,11 @@ void ofApp::update() {
 
 //--------------------------------------------------------------
 void ofApp::drawGrid() {
-    int currentDay = getCurrentDay();
-    int currentSlot = getCurrentSlot();
+    scheduler.lock();
+    const auto& schedule = scheduler.schedule;
+    const auto& apps = scheduler.apps;
+    int currentDay = scheduler.testMode ? scheduler.testDay : displayDay;
+    int currentSlot = scheduler.testMode ? scheduler.testSlot : displaySlot;
     
     ofSetColor(200);  // Light gray for all text
     
@@ -371,7 +170,7 @@ void ofApp::drawGrid() {
     // Each cell is " [#] " = 5 chars, day names are " Mon " = 5 chars (centered)
     string header = "        ";  // 8 spaces to align with "00:00    "
     for (int d = 0; d < NUM_DAYS; d++) {
-        header += " " + dayNames[d] + " ";  // 5 chars (space + Mon + space) - centered
+        header += " " + Scheduler::dayNames[d] + " ";  // 5 chars (space + Mon + space) - centered
     }
     ofDrawBitmapString(header, 5, gridStartY - 8);
     
@@ -394,7 +193,7 @@ void ofApp::drawGrid() {
         
         // Time label (show every hour)
         if (s % 2 == 0) {
-            line += slotToTimeString(s);
+            line += Scheduler::slotToTimeString(s);
         } else {
             line += "     ";
         }
@@ -428,10 +227,10 @@ void ofApp::drawGrid() {
     float statusY = gridStartY + 20;
     bool currentActive = schedule[currentDay][currentSlot];
     
-    string timeLabel = "Current: " + dayNames[currentDay] + " " + slotToTimeString(currentSlot);
+    string timeLabel = "Current: " + Scheduler::dayNames[currentDay] + " " + Scheduler::slotToTimeString(currentSlot);
     ofDrawBitmapString(timeLabel, statusX, statusY);
     
-    if (testMode) {
+    if (scheduler.testMode) {
         ofDrawBitmapString("[TEST MODE - arrows to change, 't' to exit]", statusX, statusY + 18);
     }
     
@@ -443,16 +242,26 @@ void ofApp::drawGrid() {
     }
     ofDrawBitmapString(statusText, statusX, statusY + 36);
     
-    ofDrawBitmapString("Apps controlled (" + ofToString(appPaths.size()) + "):", statusX, statusY + 60);
+    // When the scheduler wakes up next, and how often it did so far
+    string nextText = "Next change: none this week";
+    if (scheduler.hasNextTransition) {
+        const auto& next = scheduler.nextTransition;
+        nextText = "Next change: " + Scheduler::dayNames[next.day] + " " + Scheduler::slotToTimeString(next.slot)
+                 + (next.active ? " -> ACTIVE" : " -> DARKNESS");
+    }
+    ofDrawBitmapString(nextText, statusX, statusY + 54);
+    ofDrawBitmapString("Scheduler wakeups: " + ofToString(scheduler.wakeups), statusX, statusY + 72);
+    
+    ofDrawBitmapString("Apps controlled (" + ofToString(apps.size()) + "):", statusX, statusY + 96);
     
-    // Progress bars for each app (like delayOpen_v6): show delay countdown when launching
+    // Progress bars for each app (like delayOpen_v6): show each app's launch stage
     const float barWidth = 120;
     const float barHeight = 10;
     const float rowHeight = 22;
-    float rowY = statusY + 76;
+    float rowY = statusY + 112;
     
-    for (int i = 0; i < (int)appPaths.size(); i++) {
-        string appName = appPaths[i];
+    for (int i = 0; i < (int)apps.size(); i++) {
+        string appName = apps[i].path;
         size_t lastSlash = appName.rfind('/');
         if (lastSlash != string::npos) {
             appName = appName.substr(lastSlash + 1);
@@ -460,7 +269,8 @@ void ofApp::drawGrid() {
         
         float y = rowY + i * rowHeight;
         ofSetColor(200);
-        ofDrawBitmapString("[" + ofToString(appDelays[i]) + "s] " + appName, statusX, y);
+        string pidText = scheduler.appStates[i].pid > 0 ? " (pid " + ofToString(scheduler.appStates[i].pid) + ")" : "";
+        ofDrawBitmapString("[" + ofToString(apps[i].delay) + "s] " + appName + pidText, statusX, y);
         
         // Bar background (grey)
         float barX = statusX;
@@ -468,33 +278,75 @@ void ofApp::drawGrid() {
         ofSetColor(80);
         ofDrawRectangle(barX, barY, barWidth, barHeight);
         
-        if (launchingApps) {
-            if (i < launchIndex) {
-                // Already started: full bar (green)
-                ofSetColor(0, 180, 0);
-                ofDrawRectangle(barX, barY, barWidth, barHeight);
-            } else if (i == launchIndex) {
-                // Current: countdown bar (drains as time runs out)
-                float elapsed = ofGetElapsedTimef() - launchStartTime;
-                float remaining = (float)appDelays[i] - elapsed;
-                float progress = (appDelays[i] > 0) ? ofClamp(remaining / (float)appDelays[i], 0, 1) : 0;
-                ofSetColor(100, 200, 255);
-                ofDrawRectangle(barX, barY, barWidth * progress, barHeight);
+        const LaunchPipeline& launch = scheduler.launch;
+        string stageText;
+        if (scheduler.launchingApps && i < (int)launch.size()) {
+            const LaunchPipeline::Step& step = launch.getStep(i);
+            switch (step.stage) {
+                case LaunchPipeline::Waiting:
+                    // Prerequisites not ready yet: empty bar (stays grey)
+                    stageText = "waiting";
+                    break;
+                case LaunchPipeline::Delaying: {
+                    // Countdown bar (drains as time runs out)
+                    float remaining = step.delay - (ofGetElapsedTimef() - step.stageStart);
+                    float progress = (step.delay > 0) ? ofClamp(remaining / step.delay, 0, 1) : 0;
+                    ofSetColor(100, 200, 255);
+                    ofDrawRectangle(barX, barY, barWidth * progress, barHeight);
+                    break;
+                }
+                case LaunchPipeline::Starting:
+                case LaunchPipeline::Probing:
+                    // Launched, waiting until it's ready (yellow)
+                    ofSetColor(220, 200, 60);
+                    ofDrawRectangle(barX, barY, barWidth, barHeight);
+                    stageText = "waiting for " + step.probe.describe();
+                    break;
+                case LaunchPipeline::Ready:
+                    // Ready: full bar (green)
+                    ofSetColor(0, 180, 0);
+                    ofDrawRectangle(barX, barY, barWidth, barHeight);
+                    stageText = "ready after " + ofToString(step.readySeconds, 1) + "s" + (step.timedOut ? " (timed out)" : "");
+                    break;
+                case LaunchPipeline::Failed:
+                    ofSetColor(200, 60, 40);
+                    ofDrawRectangle(barX, barY, barWidth, barHeight);
+                    stageText = "failed";
+                    break;
             }
-            // i > launchIndex: empty bar (stays grey)
-        } else if (appsCurrentlyRunning) {
+        } else if (scheduler.appsCurrentlyRunning) {
             // Not launching: all bars full (apps running)
             ofSetColor(0, 180, 0);
             ofDrawRectangle(barX, barY, barWidth, barHeight);
         }
+        
+        // Supervisor state (or else the launch stage) next to the bar
+        const Scheduler::AppState& state = scheduler.appStates[i];
+        float textX = barX + barWidth + 8;
+        float textY = barY + barHeight;
+        if (state.gaveUp) {
+            ofSetColor(255, 80, 50);
+            ofDrawBitmapString("CRASH LOOP - restarts: " + ofToString(state.restartCount), textX, textY);
+        } else if (state.restartPending) {
+            float wait = max(0.0f, state.restartTime - ofGetElapsedTimef());
+            ofSetColor(255, 160, 50);
+            ofDrawBitmapString("restarting in " + ofToString(wait, 0) + "s - restarts: " + ofToString(state.restartCount), textX, textY);
+        } else if (state.restartCount > 0) {
+            ofSetColor(200);
+            ofDrawBitmapString("restarts: " + ofToString(state.restartCount), textX, textY);
+        } else if (!stageText.empty()) {
+            ofSetColor(160);
+            ofDrawBitmapString(stageText, textX, textY);
+        }
     }
     
     ofSetColor(200);  // reset for text below
     
     // Draw notice message below the status
+    lock_guard<std::mutex> guard(noticeMutex);
     if (!noticeMessage.empty()) {
         float msgX = statusX;
-        float msgY = statusY + 76 + appPaths.size() * rowHeight + 20;
+        float msgY = rowY + apps.size() * rowHeight + 20;
         
         // Fade out effect
         float elapsed = ofGetElapsedTimef() - noticeStartTime;
@@ -514,6 +366,7 @@ void ofApp::drawGrid() {
         
         ofSetColor(200);  // Reset color
     }
+    scheduler.unlock();
 }
 
 //--------------------------------------------------------------
@@ -552,64 +405,32 @@ void ofApp::draw() {
 //--------------------------------------------------------------
 void ofApp::keyPressed(int key) {
     if (key == 's') {
-        saveSchedule();
+        scheduler.lock();
+        scheduler.saveSchedule();
+        scheduler.unlock();
     } else if (key == 'l') {
-        loadSchedule();
+        scheduler.reloadSchedule();
     } else if (key == 'r') {
-        loadAppList();
+        scheduler.reloadAppList();
     } else if (key == 'o') {
-        openApps();
+        scheduler.requestOpen();
     } else if (key == 'c') {
-        closeApps();
+        scheduler.requestClose();
     } else if (key == 't') {
         // Toggle test mode
-        testMode = !testMode;
-        if (testMode) {
-            // Initialize test time to current real time
-            time_t now = time(0);
-            tm* ltm = localtime(&now);
-            int dow = ltm->tm_wday;
-            testDay = (dow == 0) ? 6 : dow - 1;
-            testSlot = ltm->tm_hour * 2 + (ltm->tm_min >= 30 ? 1 : 0);
-            ofLog() << "TEST MODE ON - Use arrow keys to change time";
-        } else {
-            ofLog() << "TEST MODE OFF - Using real time";
-            // Reset state so it re-evaluates with real time
-            lastCheckedSlot = -1;
-            lastCheckedDay = -1;
-        }
+        scheduler.toggleTestMode();
     } else if (key == OF_KEY_UP) {
         // Move time slot earlier
-        if (testMode) {
-            testSlot--;
-            if (testSlot < 0) testSlot = NUM_SLOTS - 1;
-            lastCheckedSlot = -1;  // Force re-check
-            ofLog() << "Test time: " << dayNames[testDay] << " " << slotToTimeString(testSlot);
-        }
+        scheduler.stepTestTime(0, -1);
     } else if (key == OF_KEY_DOWN) {
         // Move time slot later
-        if (testMode) {
-            testSlot++;
-            if (testSlot >= NUM_SLOTS) testSlot = 0;
-            lastCheckedSlot = -1;  // Force re-check
-            ofLog() << "Test time: " << dayNames[testDay] << " " << slotToTimeString(testSlot);
-        }
+        scheduler.stepTestTime(0, 1);
     } else if (key == OF_KEY_LEFT) {
         // Move to previous day
-        if (testMode) {
-            testDay--;
-            if (testDay < 0) testDay = NUM_DAYS - 1;
-            lastCheckedDay = -1;  // Force re-check
-            ofLog() << "Test time: " << dayNames[testDay] << " " << slotToTimeString(testSlot);
-        }
+        scheduler.stepTestTime(-1, 0);
     } else if (key == OF_KEY_RIGHT) {
         // Move to next day
-        if (testMode) {
-            testDay++;
-            if (testDay >= NUM_DAYS) testDay = 0;
-            lastCheckedDay = -1;  // Force re-check
-            ofLog() << "Test time: " << dayNames[testDay] << " " << slotToTimeString(testSlot);
-        }
+        scheduler.stepTestTime(1, 0);
     }
 }
 
@@ -629,7 +450,9 @@ void ofApp::mouseDragged(int x, int y, int button) {
     
     if (day >= 0 && slot >= 0) {
         if (day != lastDragDay || slot != lastDragSlot) {
-            schedule[day][slot] = dragPaintValue;
+            scheduler.lock();
+            scheduler.schedule[day][slot] = dragPaintValue;
+            scheduler.unlock();
             lastDragDay = day;
             lastDragSlot = slot;
         }
@@ -643,22 +466,24 @@ void ofApp::mousePressed(int x, int y, int button) {
     
     if (day >= 0 && slot >= 0) {
         // Toggle the cell
-        schedule[day][slot] = !schedule[day][slot];
+        scheduler.lock();
+        scheduler.schedule[day][slot] = !scheduler.schedule[day][slot];
         
         // Store for drag painting
-        dragPaintValue = schedule[day][slot];
+        dragPaintValue = scheduler.schedule[day][slot];
+        scheduler.unlock();
         lastDragDay = day;
         lastDragSlot = slot;
         
-        ofLog() << "Toggled " << dayNames[day] << " " << slotToTimeString(slot) 
-                << " to " << (schedule[day][slot] ? "ACTIVE" : "INACTIVE");
+        ofLog() << "Toggled " << Scheduler::dayNames[day] << " " << Scheduler::slotToTimeString(slot) 
+                << " to " << (dragPaintValue ? "ACTIVE" : "INACTIVE");
     }
 }
 
 //--------------------------------------------------------------
 void ofApp::mouseReleased(int x, int y, int button) {
-    // Save when done clicking/dragging
-    saveSchedule();
+    // Save when done clicking/dragging; the scheduler recompiles its timeline
+    scheduler.scheduleChanged();
     
     // Check for gaps if we were painting ON values
     if (lastDragDay >= 0 && dragPaintValue) {
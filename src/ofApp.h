@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ofMain.h"
+#include "Scheduler.h"
 
 class ofApp : public ofBaseApp {
 
@@ -8,6 +9,7 @@ public:
     void setup();
     void update();
     void draw();
+    void exit();
 
     void keyPressed(int key);
     void keyReleased(int key);
@@ -19,36 +21,16 @@ public:
     void dragEvent(ofDragInfo dragInfo);
     void gotMessage(ofMessage msg);
 
-    // Schedule grid: 7 days x 48 half-hour slots
-    // true = ACTIVE (apps run), false = INACTIVE (darkness, apps closed)
-    static const int NUM_DAYS = 7;
-    static const int NUM_SLOTS = 48;  // 24 hours * 2 (30-min slots)
-    bool schedule[NUM_DAYS][NUM_SLOTS];
-
-    // App control
-    vector<string> appPaths;
-    vector<int> appDelays;  // Delay in seconds before launching each app
-    bool appsCurrentlyRunning;
-    
-    // Sequential launch with progress bars (like delayOpen_v6)
-    bool launchingApps;     // true while counting down and opening apps one by one
-    int launchIndex;        // which app we're currently counting down for
-    float launchStartTime;  // when we started the countdown for current app
-    
-    // Schedule file I/O
-    void loadSchedule();
-    void saveSchedule();
-    void loadAppList();
-    
-    // Time helpers
-    int getCurrentDay();    // 0=Mon, 1=Tue, ... 6=Sun
-    int getCurrentSlot();   // 0-47 based on current time
-    string slotToTimeString(int slot);
+    // Open/close logic runs on its own thread
+    Scheduler scheduler;
+    static const int NUM_DAYS = Scheduler::NUM_DAYS;
+    static const int NUM_SLOTS = Scheduler::NUM_SLOTS;
     
-    // App control
-    void openApps();
-    void closeApps();
-    bool isAppRunning(const string& appPath);
+    // Display time, recomputed only when a half-hour boundary is crossed
+    void updateDisplayTime();
+    int displayDay;
+    int displaySlot;
+    time_t displayValidUntil;
     
     // Grid drawing
     void drawGrid();
@@ -62,27 +44,18 @@ public:
     float cellHeight;
     float labelWidth;
     
-    // Day names
-    string dayNames[7] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
-    
     // Version
     string version;
     
-    // State tracking
-    int lastCheckedSlot;
-    int lastCheckedDay;
-    
     // Drag painting
     bool dragPaintValue;
     int lastDragDay;
     int lastDragSlot;
     
-    // Test mode - override current time for testing
-    bool testMode;
-    int testSlot;
-    int testDay;
-    
-    // Message area (right side)
+    // Message area (right side), also set from the scheduler thread
+    void showNotice(const string& message);
+    void onProcessEvent(ProcessEvent& event);
+    std::mutex noticeMutex;
     string noticeMessage;
     float noticeStartTime;
     float noticeDuration;